@@ -14,6 +14,23 @@
 #include "Led.h"
 #include "Port.h"
 #include "Dio.h"
+#include "Gpt.h"
+#include "Os.h"
+#include "Os_Coroutine.h"
+#include "Det.h"
+
+/* Description: Toggle the led once per button press, resumed at every activation of App_Task */
+static Os_CoStatusType App_ToggleSequence(Os_CoroutineType * Co)
+{
+    OS_CO_BEGIN(Co);
+
+    /* Only Toggle the led when the switch is pressed after being released */
+    OS_CO_WAIT_UNTIL(Co, BUTTON_getState() == BUTTON_PRESSED);
+    LED_toggle();
+    OS_CO_WAIT_UNTIL(Co, BUTTON_getState() == BUTTON_RELEASED);
+
+    OS_CO_END(Co);
+}
 
 /* Description: Task executes once to initialize all the Modules */
 void Init_Task(void)
@@ -23,6 +40,9 @@ void Init_Task(void)
     
     /* Initialize Dio Driver */
     Dio_Init(&Dio_Configuration);
+
+    /* Initialize Gpt Driver */
+    Gpt_Init(&Gpt_Configuration);
 }
 
 /* Description: Task executes every 20 Mili-seconds to check the button state */
@@ -37,20 +57,28 @@ void Led_Task(void)
     LED_refreshOutput();
 }
 
-/* Description: Task executes every 60 Mili-seconds to get the button status and toggle the led */
+/* Description: Task activated by the Button module on every button state change to toggle the led */
 void App_Task(void)
 {
-    static uint8 button_previous_state = BUTTON_RELEASED;
-    static uint8 button_current_state  = BUTTON_RELEASED;
-	
-    button_current_state = BUTTON_getState(); /* Read the button state */
-	
-    /* Only Toggle the led in case the current state of the switch is pressed
-     * and the previous state is released */ 
-    if((button_current_state == BUTTON_PRESSED) && (button_previous_state == BUTTON_RELEASED))
-    {
-	LED_toggle();
-    }
-	
-    button_previous_state = button_current_state;
+    static Os_CoroutineType toggle_sequence;
+
+    (void)App_ToggleSequence(&toggle_sequence);
+}
+
+#if (OS_OVERRUN_POLICY == OS_OVERRUN_HOOK)
+/* Description: Called by the Os when a task is still running at its next tick */
+void Os_OverrunHook(TaskType Task_Id)
+{
+    /* Report the overrun to the Det, the task index is passed as the instance Id */
+    Det_ReportError(OS_MODULE_ID, Task_Id, OS_OVERRUN_HOOK_SID, OS_E_OVERRUN);
+}
+#endif
+
+#if (OS_STACK_MONITOR == STD_ON)
+/* Description: Called by the Os when a stack reaches its guard zone */
+void Os_StackOverflowHook(uint8 Stack_Id)
+{
+    /* Report the overflow to the Det, the stack identifier is passed as the instance Id */
+    Det_ReportError(OS_MODULE_ID, Stack_Id, OS_STACK_OVERFLOW_HOOK_SID, OS_E_STACK_OVERFLOW);
 }
+#endif
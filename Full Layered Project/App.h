@@ -23,7 +23,7 @@ void Button_Task(void);
 /* Description: Task executes every 40 Mili-seconds to refresh the LED */
 void Led_Task(void);
 
-/* Description: Task executes every 60 Mili-seconds to get the button status and toggle the led */
+/* Description: Task activated by the Button module on every button state change to toggle the led */
 void App_Task(void);
 
 #endif /* APP_H_ */
@@ -9,6 +9,7 @@
  * Author: Mohamed Tarek
  ******************************************************************************/
 #include "Dio.h"
+#include "Os.h"
 #include "Button.h"
 
 /* Global variable to hold the button state */
@@ -24,6 +25,7 @@ uint8 BUTTON_getState(void)
 void BUTTON_refreshState(void)
 {
     uint8 state = Dio_ReadChannel(DioConf_SW1_CHANNEL_ID_INDEX);
+    uint8 previous_state = g_button_state;
     
     /* Count the number of Pressed times increment if the switch pressed for 20 ms */
     static uint8 g_Pressed_Count  = 0;
@@ -54,5 +56,11 @@ void BUTTON_refreshState(void)
 	g_Released_Count      = 0;
 	g_Pressed_Count       = 0;
     }
+
+    /* Notify the application immediately instead of waiting for it to poll the state */
+    if(g_button_state != previous_state)
+    {
+	(void)ActivateTask(BUTTON_STATE_CHANGE_TASK);
+    }
 }
 /*******************************************************************************************************************/
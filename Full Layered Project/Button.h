@@ -23,6 +23,9 @@
 /* Set the Button Pin Number */
 #define BUTTON_PIN_NUM DioConf_SW1_CHANNEL_NUM
 
+/* Os task activated every time the debounced Button state changes */
+#define BUTTON_STATE_CHANGE_TASK OsConf_APP_TASK_ID_INDEX
+
 /* Description: Read the Button state Pressed/Released */
 uint8 BUTTON_getState(void);
 
@@ -30,6 +33,7 @@ uint8 BUTTON_getState(void);
  * Description: This function is called every 20ms by Os Task and it responsible for Updating 
  *              the BUTTON State. it should be in a PRESSED State if the button is pressed for 60ms.
  *		and it should be in a RELEASED State if the button is released for 60ms.
+ *              BUTTON_STATE_CHANGE_TASK is activated every time the state changes.
  */   
 void BUTTON_refreshState(void);
 
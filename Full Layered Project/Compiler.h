@@ -51,4 +51,11 @@
 /* This is used to define the abstraction of compiler keyword static */
 #define STATIC            static
 
+/* This is used to mark an intended fall through to the next case label, checked by GCC 7 and later */
+#if defined(__GNUC__) && (__GNUC__ >= 7)
+#define FALLTHROUGH       __attribute__((fallthrough))
+#else
+#define FALLTHROUGH
+#endif
+
 #endif
@@ -11,11 +11,17 @@
 
 #include "Det.h"
 
+/* Trace of the reported errors */
+#include "Os_Trace.h"
+
 Std_ReturnType Det_ReportError( uint16 ModuleId,
                       uint8 InstanceId,
                       uint8 ApiId,
                       uint8 ErrorId )
 {
+    /* The last record of the trace tells which error stopped the application */
+    OS_TRACE_EVENT(OS_TRACE_DET_REPORT, ModuleId, ((uint16)ApiId << 8) | ErrorId);
+
     while(1)
     {
 
@@ -12,6 +12,12 @@
 #include "Dio.h"
 #include "Dio_Regs.h"
 
+/* Os resource of the exclusive area protecting the port data registers */
+#include "Os.h"
+
+/* Trace of the channel writes */
+#include "Os_Trace.h"
+
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
 
 #include "Det.h"
@@ -27,6 +33,49 @@
 STATIC const Dio_ConfigType * Dio_PortChannels = NULL_PTR;
 STATIC uint8 Dio_Status = DIO_NOT_INITIALIZED;
 
+/*
+ * Description: Enter the exclusive area of a port write: take the Dio resource in a task, mask the Os
+ *              interrupts at interrupt level or before the Os scheduler runs (E_OS_CALLEVEL).
+ *              Return the GetResource result to pass to Dio_ExitExclusiveArea.
+ */
+STATIC StatusType Dio_EnterExclusiveArea(uint8 ServiceId)
+{
+	StatusType status = DIO_GET_EXCLUSIVE_AREA();
+
+	if(E_OS_CALLEVEL == status)
+	{
+		DIO_LOCK_EXCLUSIVE_AREA();
+	}
+	else if(E_OK != status)
+	{
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, ServiceId, DIO_E_EXCLUSIVE_AREA);
+#endif
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+	return status;
+}
+
+/* Description: Leave the exclusive area entered with Status, a resource which was not taken is not released */
+STATIC void Dio_ExitExclusiveArea(StatusType Status)
+{
+	if(E_OK == Status)
+	{
+		DIO_RELEASE_EXCLUSIVE_AREA();
+	}
+	else if(E_OS_CALLEVEL == Status)
+	{
+		DIO_UNLOCK_EXCLUSIVE_AREA();
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
 /************************************************************************************
 * Service Name: Dio_Init
 * Service ID[hex]: 0x10
@@ -74,6 +123,7 @@ void Dio_Init(const Dio_ConfigType * ConfigPtr)
 void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level)
 {
         volatile uint32 * Port_Ptr = NULL_PTR;
+        StatusType exclusive_area;
         boolean error = FALSE;
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
         /*Check if the driver is initialized*/
@@ -116,6 +166,7 @@ void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level)
                     case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
 		               break;
                 }
+                exclusive_area = Dio_EnterExclusiveArea(DIO_WRITE_PORT_SID);
                 if(STD_HIGH == Level)
                 {
                     uint8 iterator;
@@ -132,6 +183,7 @@ void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level)
                             CLEAR_BIT(*Port_Ptr,Dio_PortChannels->Channels[iterator].Ch_Num);
                     }
                 }
+                Dio_ExitExclusiveArea(exclusive_area);
         }
         else
         {
@@ -232,6 +284,7 @@ Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId)
 void Dio_WriteChannelGroup(const Dio_ChannelGroupType* ChannelGroupIdPtr, Dio_PortLevelType Level)
 {
         volatile uint32 * Port_Ptr = NULL_PTR;
+        StatusType exclusive_area;
         boolean error = FALSE;
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
         /*Check if the driver is initialized*/
@@ -285,7 +338,9 @@ void Dio_WriteChannelGroup(const Dio_ChannelGroupType* ChannelGroupIdPtr, Dio_Po
                     case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
 		               break;
                 }
+                exclusive_area = Dio_EnterExclusiveArea(DIO_WRITE_CHANNEL_GROUP_SID);
                 *Port_Ptr = (*Port_Ptr & ~ChannelGroupIdPtr->mask) | (Level << ChannelGroupIdPtr->offset);
+                Dio_ExitExclusiveArea(exclusive_area);
         }
         else
         {
@@ -385,6 +440,7 @@ Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType* ChannelGroupI
 void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 {
 	volatile uint32 * Port_Ptr = NULL_PTR;
+	StatusType exclusive_area;
 	boolean error = FALSE;
 
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
@@ -432,6 +488,8 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
                     case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
 		               break;
 		}
+		/* The other channels of the port may be written meanwhile by a preempting task */
+		exclusive_area = Dio_EnterExclusiveArea(DIO_WRITE_CHANNEL_SID);
 		if(Level == STD_HIGH)
 		{
 			/* Write Logic High */
@@ -442,6 +500,8 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 			/* Write Logic Low */
 			CLEAR_BIT(*Port_Ptr,Dio_PortChannels->Channels[ChannelId].Ch_Num);
 		}
+		Dio_ExitExclusiveArea(exclusive_area);
+		OS_TRACE_EVENT(OS_TRACE_DIO_WRITE, ChannelId, Level);
 	}
 	else
 	{
@@ -584,6 +644,7 @@ Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 {
 	volatile uint32 * Port_Ptr = NULL_PTR;
 	Dio_LevelType output = STD_LOW;
+	StatusType exclusive_area;
 	boolean error = FALSE;
 
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
@@ -632,6 +693,7 @@ Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 		               break;
 		}
 		/* Read the required channel and write the required level */
+		exclusive_area = Dio_EnterExclusiveArea(DIO_FLIP_CHANNEL_SID);
 		if(BIT_IS_SET(*Port_Ptr, Dio_PortChannels->Channels[ChannelId].Ch_Num))
 		{
 			CLEAR_BIT(*Port_Ptr,Dio_PortChannels->Channels[ChannelId].Ch_Num);
@@ -642,6 +704,8 @@ Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 			SET_BIT(*Port_Ptr, Dio_PortChannels->Channels[ChannelId].Ch_Num);
 			output = STD_HIGH;
 		}
+		Dio_ExitExclusiveArea(exclusive_area);
+		OS_TRACE_EVENT(OS_TRACE_DIO_FLIP, ChannelId, output);
 	}
 	else
 	{
@@ -133,6 +133,12 @@
  * error code (Not exist in AUTOSAR 4.0.3 DIO SWS Document.
  */
 #define DIO_E_UNINIT                   (uint8)0xF0
+
+/*
+ * The exclusive area of a port write could not be taken (Os resource not configured for the
+ * calling task or already taken by it), reported using following error code (Not exist in AUTOSAR 4.0.3 DIO SWS Document.
+ */
+#define DIO_E_EXCLUSIVE_AREA           (uint8)0xF1
 /*******************************************************************************
  *                              Module Data Types                              *
  *******************************************************************************/
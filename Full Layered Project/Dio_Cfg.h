@@ -35,6 +35,23 @@
 /* Pre-compile option for presence of Dio_FlipChannel API */
 #define DIO_FLIP_CHANNEL_API                (STD_ON)
 
+/*
+ * Exclusive area of the read-modify-write of the port data registers, mapped to the Os resource
+ * shared by the tasks writing the channels (priority ceiling). The resource is shared with the
+ * interrupts (Isr_Users), its owner masks the Os interrupts so an interrupt never writes a port
+ * in the middle of the read-modify-write of a task.
+ * DIO_GET_EXCLUSIVE_AREA evaluates to the GetResource result, the resource is only released after E_OK.
+ */
+#define DIO_GET_EXCLUSIVE_AREA()            GetResource(OsConf_DIO_RESOURCE_ID_INDEX)
+#define DIO_RELEASE_EXCLUSIVE_AREA()        ((void)ReleaseResource(OsConf_DIO_RESOURCE_ID_INDEX))
+
+/*
+ * Lock of the exclusive area where the resource services return E_OS_CALLEVEL: at interrupt level
+ * and before the Os scheduler runs (Init_Task), mapped to the Os interrupts lock.
+ */
+#define DIO_LOCK_EXCLUSIVE_AREA()           SuspendOSInterrupts()
+#define DIO_UNLOCK_EXCLUSIVE_AREA()         ResumeOSInterrupts()
+
 /* Number of the configured Dio Ports */
 #define DIO_CONFIGURED_PORTS                (0U)
    
@@ -4,21 +4,818 @@
  *
  * File Name: Gpt.c
  *
- * Description: Source file for TM4C123GH6PM Microcontroller - SysTick Timer Driver.
+ * Description: Source file for TM4C123GH6PM Microcontroller - Gpt Driver.
+ *              The Gpt services are common to the target and the host builds, the
+ *              timer hardware functions and the SysTick Timer are implemented here
+ *              for the target and in Gpt_Host.c for the host.
  *
  * Author: Mohamed Tarek
  ******************************************************************************/
 
 #include "Gpt.h"
+
+/* Trace of the SysTick and timers interrupts */
+#include "Os_Trace.h"
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+
+#include "Det.h"
+/* AUTOSAR Version checking between Det and Gpt Modules */
+#if ((DET_AR_MAJOR_VERSION != GPT_AR_RELEASE_MAJOR_VERSION)\
+ || (DET_AR_MINOR_VERSION != GPT_AR_RELEASE_MINOR_VERSION)\
+ || (DET_AR_PATCH_VERSION != GPT_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Det.h does not match the expected version"
+#endif
+
+#endif
+
+/* States of a Gpt channel */
+#define GPT_CHANNEL_INITIALIZED        (0U)    /* Never started since Gpt_Init */
+#define GPT_CHANNEL_RUNNING            (1U)
+#define GPT_CHANNEL_STOPPED            (2U)    /* Stopped by Gpt_StopTimer */
+#define GPT_CHANNEL_EXPIRED            (3U)    /* One-shot channel reached its target time */
+
+/* No channel on a timer */
+#define GPT_NO_CHANNEL                 (0xFFU)
+
+STATIC const Gpt_ConfigChannel * Gpt_Channels = NULL_PTR;
+STATIC uint8 Gpt_Status = GPT_NOT_INITIALIZED;
+
+/* State, target time, time elapsed at the stop and notification enable of every channel */
+STATIC volatile uint8 Gpt_ChannelState[GPT_CONFIGURED_CHANNELS];
+STATIC Gpt_ValueType Gpt_ChannelTarget[GPT_CONFIGURED_CHANNELS];
+STATIC Gpt_ValueType Gpt_ChannelStopTime[GPT_CONFIGURED_CHANNELS];
+STATIC boolean Gpt_NotificationEnabled[GPT_CONFIGURED_CHANNELS];
+
+/* Channel of every timer, GPT_NO_CHANNEL for the unused timers */
+STATIC uint8 Gpt_TimerChannel[GPT_TIMERS_NUM];
+
+/* SysTick subscriber ... its call back runs when Countdown periods are elapsed, then every Divider periods */
+typedef struct
+{
+    void (*Call_Back)(void);
+    uint16 Divider;
+    uint16 Countdown;
+} SysTick_SubscriberType;
+
+/* SysTick subscribers sorted by divider, the interrupt walks the first SysTick_Subscribers_Num entries */
+STATIC SysTick_SubscriberType SysTick_Subscribers[SYSTICK_MAX_SUBSCRIBERS];
+STATIC uint8 SysTick_Subscribers_Num = 0U;
+
+#if (SYSTICK_ISR_STATS == STD_ON)
+/* Longest SysTick interrupt in timestamp counts */
+STATIC uint32 SysTick_Max_Isr_Time = 0U;
+#endif
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+/*********************************************************************************************/
+/* Description: Report the Det errors of a service called with a channel, return TRUE if there is an error */
+static boolean Gpt_CheckChannel(Gpt_ChannelType Channel, uint8 ServiceId)
+{
+    boolean error = FALSE;
+
+    /* Check if the driver is initialized */
+    if(GPT_NOT_INITIALIZED == Gpt_Status)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, ServiceId, GPT_E_UNINIT);
+        error = TRUE;
+    }
+    /* Check if the channel is valid */
+    else if(GPT_CONFIGURED_CHANNELS <= Channel)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, ServiceId, GPT_E_PARAM_CHANNEL);
+        error = TRUE;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+    return error;
+}
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_Init
+* Service ID[hex]: 0x01
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ConfigPtr - Pointer to post-build configuration data
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to Initialize the Gpt module: every configured timer is set up
+*              in the mode of its channel, stopped, with the notification disabled.
+************************************************************************************/
+void Gpt_Init(const Gpt_ConfigType * ConfigPtr)
+{
+    Gpt_ChannelType channel;
+    Gpt_TimerType timer;
+    boolean error = FALSE;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    /* check if the input configuration pointer is not a NULL_PTR */
+    if(NULL_PTR == ConfigPtr)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_INIT_SID, GPT_E_PARAM_CONFIG);
+        error = TRUE;
+    }
+    else if(GPT_INITIALIZED == Gpt_Status)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_INIT_SID, GPT_E_ALREADY_INITIALIZED);
+        error = TRUE;
+    }
+    else
+    {
+#if (GPT_PREDEF_TIMER_API == STD_ON)
+        /* Check if no channel uses the timer of the predefined timer */
+        for(channel = 0; channel < GPT_CONFIGURED_CHANNELS; channel++)
+        {
+            if(GPT_PREDEF_TIMER_WTIMER == ConfigPtr->Channels[channel].Timer)
+            {
+                Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_INIT_SID, GPT_E_PARAM_CONFIG);
+                error = TRUE;
+            }
+        }
+#endif
+    }
+#endif
+    if(FALSE == error)
+    {
+        Gpt_Channels = ConfigPtr->Channels; /* address of the first channel */
+
+        for(timer = 0; timer < GPT_TIMERS_NUM; timer++)
+        {
+            Gpt_TimerChannel[timer] = GPT_NO_CHANNEL;
+        }
+        for(channel = 0; channel < GPT_CONFIGURED_CHANNELS; channel++)
+        {
+            Gpt_ChannelState[channel]        = GPT_CHANNEL_INITIALIZED;
+            Gpt_ChannelTarget[channel]       = 0;
+            Gpt_ChannelStopTime[channel]     = 0;
+            Gpt_NotificationEnabled[channel] = FALSE;
+            Gpt_TimerChannel[Gpt_Channels[channel].Timer] = channel;
+            Gpt_HwInit(&Gpt_Channels[channel]);
+        }
+#if (GPT_PREDEF_TIMER_API == STD_ON)
+        Gpt_HwStartPredefTimer();
+#endif
+        Gpt_Status = GPT_INITIALIZED;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+#if (GPT_DEINIT_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_DeInit
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop the configured timers and disable their interrupts,
+*              all the channels shall be stopped.
+************************************************************************************/
+void Gpt_DeInit(void)
+{
+    Gpt_ChannelType channel;
+    boolean error = FALSE;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the driver is initialized */
+    if(GPT_NOT_INITIALIZED == Gpt_Status)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_DEINIT_SID, GPT_E_UNINIT);
+        error = TRUE;
+    }
+    else
+    {
+        for(channel = 0; channel < GPT_CONFIGURED_CHANNELS; channel++)
+        {
+            if(GPT_CHANNEL_RUNNING == Gpt_ChannelState[channel])
+            {
+                Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_DEINIT_SID, GPT_E_BUSY);
+                error = TRUE;
+            }
+        }
+    }
+#endif
+    if(FALSE == error)
+    {
+        for(channel = 0; channel < GPT_CONFIGURED_CHANNELS; channel++)
+        {
+            Gpt_HwDeInit(&Gpt_Channels[channel]);
+        }
+        Gpt_Status   = GPT_NOT_INITIALIZED;
+#if (GPT_PREDEF_TIMER_API == STD_ON)
+        Gpt_HwStopPredefTimer();
+#endif
+        Gpt_Channels = NULL_PTR;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+#endif
+
+#if (GPT_TIME_ELAPSED_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_GetTimeElapsed
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Gpt_ValueType - Ticks elapsed since the start (or the last expiry in
+*                               continuous mode)
+* Description: Function to read the time elapsed of a channel: the running time of a
+*              running channel, the time at the stop of a stopped channel, the target
+*              time of an expired one-shot channel and 0 before the first start.
+************************************************************************************/
+Gpt_ValueType Gpt_GetTimeElapsed(Gpt_ChannelType Channel)
+{
+    Gpt_ValueType elapsed = 0;
+    boolean error = FALSE;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    error = Gpt_CheckChannel(Channel, GPT_GET_TIME_ELAPSED_SID);
+#endif
+    if(FALSE == error)
+    {
+        switch(Gpt_ChannelState[Channel])
+        {
+            case GPT_CHANNEL_RUNNING:
+                elapsed = Gpt_HwGetElapsed(&Gpt_Channels[Channel]);
+                break;
+            case GPT_CHANNEL_STOPPED:
+                elapsed = Gpt_ChannelStopTime[Channel];
+                break;
+            case GPT_CHANNEL_EXPIRED:
+                elapsed = Gpt_ChannelTarget[Channel];
+                break;
+            default:
+                /* Not started ... 0 */
+                break;
+        }
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+    return elapsed;
+}
+#endif
+
+#if (GPT_TIME_REMAINING_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_GetTimeRemaining
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Gpt_ValueType - Ticks remaining until the next expiry
+* Description: Function to read the time remaining of a channel: the target time minus
+*              the time elapsed for a running or stopped channel, 0 for an expired
+*              one-shot channel and before the first start.
+************************************************************************************/
+Gpt_ValueType Gpt_GetTimeRemaining(Gpt_ChannelType Channel)
+{
+    Gpt_ValueType remaining = 0;
+    boolean error = FALSE;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    error = Gpt_CheckChannel(Channel, GPT_GET_TIME_REMAINING_SID);
+#endif
+    if(FALSE == error)
+    {
+        switch(Gpt_ChannelState[Channel])
+        {
+            case GPT_CHANNEL_RUNNING:
+                remaining = Gpt_ChannelTarget[Channel] - Gpt_HwGetElapsed(&Gpt_Channels[Channel]);
+                break;
+            case GPT_CHANNEL_STOPPED:
+                remaining = Gpt_ChannelTarget[Channel] - Gpt_ChannelStopTime[Channel];
+                break;
+            default:
+                /* Expired or not started ... 0 */
+                break;
+        }
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+    return remaining;
+}
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_StartTimer
+* Service ID[hex]: 0x05
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+*                  Value   - Target time in number of ticks
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start a channel, it expires after Value ticks: a one-shot
+*              channel stops, a continuous channel starts again.
+************************************************************************************/
+void Gpt_StartTimer(Gpt_ChannelType Channel, Gpt_ValueType Value)
+{
+    boolean error = FALSE;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    error = Gpt_CheckChannel(Channel, GPT_START_TIMER_SID);
+    if(FALSE == error)
+    {
+        /* Check if the channel is not running */
+        if(GPT_CHANNEL_RUNNING == Gpt_ChannelState[Channel])
+        {
+            Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_START_TIMER_SID, GPT_E_BUSY);
+            error = TRUE;
+        }
+        /* Check if the target time is valid */
+        else if(0U == Value)
+        {
+            Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_START_TIMER_SID, GPT_E_PARAM_VALUE);
+            error = TRUE;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+#endif
+    if(FALSE == error)
+    {
+        /* Running before the timer starts, so the interrupt of a very short one-shot can only set it expired */
+        Gpt_ChannelTarget[Channel] = Value;
+        Gpt_ChannelState[Channel]  = GPT_CHANNEL_RUNNING;
+        Gpt_HwStart(&Gpt_Channels[Channel], Value);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+/************************************************************************************
+* Service Name: Gpt_StopTimer
+* Service ID[hex]: 0x06
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop a running channel, the time elapsed at the stop is kept
+*              for Gpt_GetTimeElapsed. Nothing is done for a channel not running.
+************************************************************************************/
+void Gpt_StopTimer(Gpt_ChannelType Channel)
+{
+    boolean error = FALSE;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    error = Gpt_CheckChannel(Channel, GPT_STOP_TIMER_SID);
+#endif
+    if((FALSE == error) && (GPT_CHANNEL_RUNNING == Gpt_ChannelState[Channel]))
+    {
+        Gpt_HwStop(&Gpt_Channels[Channel]);
+        Gpt_ChannelStopTime[Channel] = Gpt_HwGetElapsed(&Gpt_Channels[Channel]);
+        Gpt_ChannelState[Channel]    = GPT_CHANNEL_STOPPED;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+#if (GPT_ENABLE_DISABLE_NOTIFICATION_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_EnableNotification
+* Service ID[hex]: 0x07
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to call the notification of a channel at its next expiries.
+************************************************************************************/
+void Gpt_EnableNotification(Gpt_ChannelType Channel)
+{
+    boolean error = FALSE;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    error = Gpt_CheckChannel(Channel, GPT_ENABLE_NOTIFICATION_SID);
+    /* Check if the channel has a notification */
+    if((FALSE == error) && (NULL_PTR == Gpt_Channels[Channel].Notification))
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_ENABLE_NOTIFICATION_SID, GPT_E_PARAM_CHANNEL);
+        error = TRUE;
+    }
+#endif
+    if(FALSE == error)
+    {
+        Gpt_NotificationEnabled[Channel] = TRUE;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+/************************************************************************************
+* Service Name: Gpt_DisableNotification
+* Service ID[hex]: 0x08
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop calling the notification of a channel, the channel
+*              keeps running.
+************************************************************************************/
+void Gpt_DisableNotification(Gpt_ChannelType Channel)
+{
+    boolean error = FALSE;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    error = Gpt_CheckChannel(Channel, GPT_DISABLE_NOTIFICATION_SID);
+    /* Check if the channel has a notification */
+    if((FALSE == error) && (NULL_PTR == Gpt_Channels[Channel].Notification))
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_DISABLE_NOTIFICATION_SID, GPT_E_PARAM_CHANNEL);
+        error = TRUE;
+    }
+#endif
+    if(FALSE == error)
+    {
+        Gpt_NotificationEnabled[Channel] = FALSE;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+#endif
+
+#if (GPT_VERSION_INFO_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_GetVersionInfo
+* Service ID[hex]: 0x00
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): VersionInfo - Pointer to where to store the version information of this module.
+* Return value: None
+* Description: Function to get the version information of this module.
+************************************************************************************/
+void Gpt_GetVersionInfo(Std_VersionInfoType *versioninfo)
+{
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if input pointer is not Null pointer */
+    if(NULL_PTR == versioninfo)
+    {
+        /* Report to DET  */
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_GET_VERSION_INFO_SID, GPT_E_PARAM_POINTER);
+    }
+    else
+#endif /* (GPT_DEV_ERROR_DETECT == STD_ON) */
+    {
+        /* Copy the vendor Id */
+        versioninfo->vendorID = (uint16)GPT_VENDOR_ID;
+        /* Copy the module Id */
+        versioninfo->moduleID = (uint16)GPT_MODULE_ID;
+        /* Copy Software Major Version */
+        versioninfo->sw_major_version = (uint8)GPT_SW_MAJOR_VERSION;
+        /* Copy Software Minor Version */
+        versioninfo->sw_minor_version = (uint8)GPT_SW_MINOR_VERSION;
+        /* Copy Software Patch Version */
+        versioninfo->sw_patch_version = (uint8)GPT_SW_PATCH_VERSION;
+    }
+}
+#endif
+
+#if (GPT_PREDEF_TIMER_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_GetPredefTimerValue
+* Service ID[hex]: 0x0D
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PredefTimer - GPT Predefined Timer
+* Parameters (inout): None
+* Parameters (out): TimeValuePtr - Pointer to time value destination data in RAM
+* Return value: Std_ReturnType - E_OK or E_NOT_OK if the driver is not initialized
+* Description: Function to read the time of a predefined timer: the microseconds since
+*              Gpt_Init (hundreds of microseconds for GPT_PREDEF_TIMER_100US_32BIT)
+*              wrapping around at the width of the timer.
+************************************************************************************/
+Std_ReturnType Gpt_GetPredefTimerValue(Gpt_PredefTimerType PredefTimer, uint32 * TimeValuePtr)
+{
+    Std_ReturnType result = E_NOT_OK;
+    uint64 time_us;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the driver is initialized */
+    if(GPT_NOT_INITIALIZED == Gpt_Status)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_GET_PREDEF_TIMER_VALUE_SID, GPT_E_UNINIT);
+    }
+    /* Check if the predefined timer is valid */
+    else if(GPT_PREDEF_TIMER_100US_32BIT < PredefTimer)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_GET_PREDEF_TIMER_VALUE_SID, GPT_E_PARAM_PREDEF_TIMER);
+    }
+    /* Check if input pointer is not Null pointer */
+    else if(NULL_PTR == TimeValuePtr)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_GET_PREDEF_TIMER_VALUE_SID, GPT_E_PARAM_POINTER);
+    }
+    else
+#endif
+    if(GPT_INITIALIZED == Gpt_Status)
+    {
+        time_us = Gpt_HwGetPredefTimer() / (GPT_TICK_FREQUENCY / 1000000UL);
+        switch(PredefTimer)
+        {
+            case GPT_PREDEF_TIMER_1US_16BIT:
+                *TimeValuePtr = (uint32)(time_us & 0xFFFFU);
+                break;
+            case GPT_PREDEF_TIMER_1US_24BIT:
+                *TimeValuePtr = (uint32)(time_us & 0xFFFFFFU);
+                break;
+            case GPT_PREDEF_TIMER_100US_32BIT:
+                *TimeValuePtr = (uint32)(time_us / 100U);
+                break;
+            default:
+                *TimeValuePtr = (uint32)time_us;
+                break;
+        }
+        result = E_OK;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+    return result;
+}
+
+/************************************************************************************
+* Service Name: Gpt_GetPredefTimerValue64
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint64 - Ticks of GPT_TICK_FREQUENCY since Gpt_Init, 0 before
+* Description: Function to read the whole 64-bit predefined timer, a constant time read
+*              without masking the interrupts for timestamps in the tasks and the ISRs.
+************************************************************************************/
+uint64 Gpt_GetPredefTimerValue64(void)
+{
+    uint64 ticks = 0;
+
+    /* The timer registers are not clocked before Gpt_Init */
+    if(GPT_INITIALIZED == Gpt_Status)
+    {
+        ticks = Gpt_HwGetPredefTimer();
+    }
+    return ticks;
+}
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_TimerIsr
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Timer - Timer raising the timeout interrupt
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function called by the interrupt handler of a timer at the expiry of its
+*              channel: a one-shot channel is expired, the notification is called if
+*              it is enabled.
+************************************************************************************/
+void Gpt_TimerIsr(Gpt_TimerType Timer)
+{
+    uint8 channel = Gpt_TimerChannel[Timer];
+
+    OS_TRACE_EVENT(OS_TRACE_ISR_ENTER, OS_TRACE_ISR_GPT(Timer), 0U);
+
+    if((GPT_INITIALIZED == Gpt_Status) && (GPT_NO_CHANNEL != channel))
+    {
+        Gpt_HwClearInterrupt(&Gpt_Channels[channel]);
+        if(GPT_CH_MODE_ONESHOT == Gpt_Channels[channel].Mode)
+        {
+            Gpt_ChannelState[channel] = GPT_CHANNEL_EXPIRED;
+        }
+        if((TRUE == Gpt_NotificationEnabled[channel]) && (NULL_PTR != Gpt_Channels[channel].Notification))
+        {
+            (*Gpt_Channels[channel].Notification)();
+        }
+    }
+
+    OS_TRACE_EVENT(OS_TRACE_ISR_EXIT, OS_TRACE_ISR_GPT(Timer), 0U);
+}
+
+/************************************************************************************
+* Service Name: SysTick_Start
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Tick_Time_Us - Time in microseconds (1 up to SYSTICK_MAX_START_TIME_US)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK: the SysTick Timer is started
+*                                E_NOT_OK: Tick_Time_Us out of range, the timer is not changed
+* Description: Function to start the SysTick Timer with a period of n microseconds, in
+*              range the period always has an exact split (SYSTICK_MAX_START_TIME_US).
+************************************************************************************/
+Std_ReturnType SysTick_Start(uint32 Tick_Time_Us)
+{
+    Std_ReturnType result = E_NOT_OK;
+
+    if((0U != Tick_Time_Us) && (SYSTICK_MAX_START_TIME_US >= Tick_Time_Us))
+    {
+        result = SysTick_StartCycles(Tick_Time_Us * SYSTICK_COUNTS_PER_US);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+    return result;
+}
+
+/************************************************************************************
+* Service Name: SysTick_Subscribe
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Ptr2Func - Call Back function address
+*                  Divider - The call back is called every Divider SysTick periods
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK: the call back is registered
+*                                E_NOT_OK: NULL call back, Divider 0 or SYSTICK_MAX_SUBSCRIBERS reached
+* Description: Function to register a SysTick Timer call back. The table is kept sorted
+*              by divider when the subscriber is inserted, so the interrupt only walks
+*              the registered entries in order, the every-period call backs first.
+************************************************************************************/
+Std_ReturnType SysTick_Subscribe(void (*Ptr2Func)(void), uint16 Divider)
+{
+    Std_ReturnType result = E_OK;
+    uint8 index;
+
+    if((NULL_PTR == Ptr2Func) || (0U == Divider))
+    {
+        result = E_NOT_OK;
+    }
+    else
+    {
+        /* The SysTick interrupt shall not walk the table while the entries are moved */
+        GPT_ENTER_CRITICAL();
+        if(SYSTICK_MAX_SUBSCRIBERS <= SysTick_Subscribers_Num)
+        {
+            result = E_NOT_OK;
+        }
+        else
+        {
+            /* Move the subscribers with a larger divider one entry down */
+            index = SysTick_Subscribers_Num;
+            while((index > 0U) && (SysTick_Subscribers[index - 1U].Divider > Divider))
+            {
+                SysTick_Subscribers[index] = SysTick_Subscribers[index - 1U];
+                index--;
+            }
+            SysTick_Subscribers[index].Call_Back = Ptr2Func;
+            SysTick_Subscribers[index].Divider   = Divider;
+            SysTick_Subscribers[index].Countdown = Divider;
+            SysTick_Subscribers_Num++;
+        }
+        GPT_EXIT_CRITICAL();
+    }
+    return result;
+}
+
+#if (SYSTICK_ISR_STATS == STD_ON)
+/************************************************************************************
+* Service Name: SysTick_GetMaxIsrTime
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Longest SysTick interrupt in timestamp counts (OS_PORT_TIMESTAMP_HZ)
+* Description: Function to read the worst case duration of the SysTick interrupt, from
+*              the handler entry to the return of the last call back.
+************************************************************************************/
+uint32 SysTick_GetMaxIsrTime(void)
+{
+    return SysTick_Max_Isr_Time;
+}
+
+/************************************************************************************
+* Service Name: SysTick_ResetMaxIsrTime
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to restart the measurement of the worst case SysTick interrupt.
+************************************************************************************/
+void SysTick_ResetMaxIsrTime(void)
+{
+    SysTick_Max_Isr_Time = 0U;
+}
+#endif
+
+/************************************************************************************
+* Service Name: SysTick_Isr
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Periods - SysTick_Start periods elapsed since the last interrupt
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function called by the SysTick interrupt handler: every subscriber whose
+*              countdown is elapsed is called once, even if several of its periods
+*              passed while SysTick_ChangePeriod lengthened the interrupts period.
+************************************************************************************/
+void SysTick_Isr(uint16 Periods)
+{
+    SysTick_SubscriberType * subscriber = SysTick_Subscribers;
+    SysTick_SubscriberType * last = &SysTick_Subscribers[SysTick_Subscribers_Num];
+#if (SYSTICK_ISR_STATS == STD_ON)
+    uint32 start_time = GPT_GET_TIMESTAMP();
+    uint32 isr_time;
+#endif
+
+    OS_TRACE_EVENT(OS_TRACE_ISR_ENTER, OS_TRACE_ISR_SYSTICK, 0U);
+
+    for(; subscriber < last; subscriber++)
+    {
+        if(subscriber->Countdown > Periods)
+        {
+            subscriber->Countdown -= Periods;
+        }
+        else
+        {
+            /* Next call Divider periods after the missed expiry */
+            subscriber->Countdown = subscriber->Divider - ((Periods - subscriber->Countdown) % subscriber->Divider);
+            (*subscriber->Call_Back)(); /* call the function in the upper layer using call-back concept */
+        }
+    }
+
+    OS_TRACE_EVENT(OS_TRACE_ISR_EXIT, OS_TRACE_ISR_SYSTICK, 0U);
+
+#if (SYSTICK_ISR_STATS == STD_ON)
+    isr_time = GPT_GET_TIMESTAMP() - start_time;
+    if(isr_time > SysTick_Max_Isr_Time)
+    {
+        SysTick_Max_Isr_Time = isr_time;
+    }
+#endif
+}
+
+/* Target SysTick and Gpt timers, also built on the host on simulated registers with GPT_SIM defined */
+#if !defined(__linux__) || defined(GPT_SIM)
+
 #include "tm4c123gh6pm_registers.h"
+#include "Gpt_Regs.h"
+#include "Common_Macros.h"
 
 #define SYSTICK_PRIORITY_MASK  0x1FFFFFFF
 #define SYSTICK_INTERRUPT_PRIORITY  3
 #define SYSTICK_PRIORITY_BITS_POS   29
 
-/* Global pointer to function used to point upper layer functions
- * to be used in Call Back */
-static void (*g_SysTick_Call_Back_Ptr)(void) = NULL_PTR;
+/* SysTick Control Register ENABLE bit */
+#define SYSTICK_ENABLE_MASK         0x00000001
+
+/* PENDSTSET bit in the Interrupt Control and State register ... SysTick interrupt is pending */
+#define SYSTICK_PENDING_MASK        0x04000000
+
+/* Counts lost while the timer is stopped inside SysTick_ChangePeriod (instructions between disable and enable) */
+#define SYSTICK_STOPPED_COUNTS      4U
+
+/* Period of SysTick_Start in counts and the SysTick_Start periods in the current period */
+static uint32 g_SysTick_Base_Counts = 1;
+static uint16 g_SysTick_Periods = 1;
+
+/* Interrupts of one SysTick_Start period (software extension) and the interrupts counted in the running one */
+static uint8 g_SysTick_Extension = 1;
+static volatile uint8 g_SysTick_Extension_Count = 0;
 
 /************************************************************************************
 * Service Name: SysTick_Handler
@@ -26,39 +823,80 @@ static void (*g_SysTick_Call_Back_Ptr)(void) = NULL_PTR;
 ************************************************************************************/
 void SysTick_Handler(void)
 {
-    /* Check if the Timer0_setCallBack is already called */
-    if(g_SysTick_Call_Back_Ptr != NULL_PTR)
+    /* No need to clear the trigger flag (COUNT) bit ... it cleared automatically by the HW */
+    g_SysTick_Extension_Count++;
+    if(g_SysTick_Extension_Count >= g_SysTick_Extension)
     {
-        (*g_SysTick_Call_Back_Ptr)(); /* call the function in the scheduler using call-back concept */
+        g_SysTick_Extension_Count = 0;
+        /* Call the subscribers ... the period of this interrupt was set before SysTick_ChangePeriod is called by a subscriber */
+        SysTick_Isr(g_SysTick_Periods);
     }
-    /* No need to clear the trigger flag (COUNT) bit ... it cleared automatically by the HW */
 }
 
 /************************************************************************************
-* Service Name: SysTick_Start
+* Service Name: SysTick_StartCycles
 * Sync/Async: Synchronous
 * Reentrancy: reentrant
-* Parameters (in): Tick_Time - Time in miliseconds
+* Parameters (in): Tick_Cycles - Time in core cycles (2 up to SYSTICK_MAX_START_CYCLES)
 * Parameters (inout): None
 * Parameters (out): None
-* Return value: None
-* Description: Function to Setup the SysTick Timer configuration to count n miliseconds:
+* Return value: Std_ReturnType - E_OK: the SysTick Timer is started
+*                                E_NOT_OK: Tick_Cycles out of range or no exact split, the timer is not changed
+* Description: Function to Setup the SysTick Timer configuration to count n core cycles:
+*              - Split the period in the fewest equal interrupt periods fitting the reload register
 *              - Set the Reload value
-*              - Enable SysTick Timer with System clock 16Mhz
+*              - Enable SysTick Timer with the System clock (MCU_CORE_CLOCK_HZ)
 *              - Enable SysTick Timer Interrupt and set its priority
 ************************************************************************************/
-void SysTick_Start(uint16 Tick_Time)
+Std_ReturnType SysTick_StartCycles(uint32 Tick_Cycles)
 {
-    SYSTICK_CTRL_REG    = 0;                         /* Disable the SysTick Timer by Clear the ENABLE Bit */
-    SYSTICK_RELOAD_REG  = 15999 * Tick_Time;         /* Set the Reload value to count n miliseconds */
-    SYSTICK_CURRENT_REG = 0;                         /* Clear the Current Register value */
-    /* Configure the SysTick Control Register 
-     * Enable the SysTick Timer (ENABLE = 1)
-     * Enable SysTick Interrupt (INTEN = 1)
-     * Choose the clock source to be System Clock (CLK_SRC = 1) */
-    SYSTICK_CTRL_REG   |= 0x07;
-    /* Assign priority level 3 to the SysTick Interrupt */
-    NVIC_SYSTEM_PRI3_REG =  (NVIC_SYSTEM_PRI3_REG & SYSTICK_PRIORITY_MASK) | (SYSTICK_INTERRUPT_PRIORITY << SYSTICK_PRIORITY_BITS_POS);
+    Std_ReturnType result = E_NOT_OK;
+    uint32 extension;
+
+    /* The reload value shall be at least 1 */
+    if((Tick_Cycles >= 2U) && (Tick_Cycles <= SYSTICK_MAX_START_CYCLES))
+    {
+        /* Fewest interrupts per period dividing it exactly, searched from the one filling the reload register */
+        extension = ((Tick_Cycles - 1U) / SYSTICK_MAX_RELOAD_COUNTS) + 1U;
+        while((E_NOT_OK == result) && (extension <= SYSTICK_MAX_EXTENSION))
+        {
+            if((Tick_Cycles % extension) == 0U)
+            {
+                result = E_OK;
+            }
+            else
+            {
+                extension++;
+            }
+        }
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    if(E_OK == result)
+    {
+        SYSTICK_CTRL_REG    = 0;                         /* Disable the SysTick Timer by Clear the ENABLE Bit */
+        g_SysTick_Base_Counts     = Tick_Cycles;
+        g_SysTick_Periods         = 1;
+        g_SysTick_Extension       = (uint8)extension;
+        g_SysTick_Extension_Count = 0;
+        SYSTICK_RELOAD_REG  = (Tick_Cycles / extension) - 1; /* Set the Reload value to count one interrupt period */
+        SYSTICK_CURRENT_REG = 0;                         /* Clear the Current Register value */
+        /* Configure the SysTick Control Register
+         * Enable the SysTick Timer (ENABLE = 1)
+         * Enable SysTick Interrupt (INTEN = 1)
+         * Choose the clock source to be System Clock (CLK_SRC = 1) */
+        SYSTICK_CTRL_REG   |= 0x07;
+        /* Assign priority level 3 to the SysTick Interrupt */
+        NVIC_SYSTEM_PRI3_REG =  (NVIC_SYSTEM_PRI3_REG & SYSTICK_PRIORITY_MASK) | (SYSTICK_INTERRUPT_PRIORITY << SYSTICK_PRIORITY_BITS_POS);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+    return result;
 }
 
 /************************************************************************************
@@ -77,16 +915,358 @@ void SysTick_Stop(void)
 }
 
 /************************************************************************************
-* Service Name: SysTick_SetCallBack
+* Service Name: SysTick_ChangePeriod
 * Sync/Async: Synchronous
-* Reentrancy: reentrant
-* Parameters (in): Ptr2Func - Call Back function address
+* Reentrancy: Non reentrant
+* Parameters (in): Tick_Time_Us - Time in microseconds (1 up to SYSTICK_MAX_TICK_TIME_US)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK: the period is changed
+*                                E_NOT_OK: Tick_Time_Us out of range, shorter than the SysTick_Start
+*                                          period or this one is extended in software,
+*                                          the period is not changed
+* Description: Function to change the period of the running SysTick Timer, the next
+*              interrupt fires Tick_Time_Us after the last one without losing the counts
+*              already elapsed. It shall be called from a SysTick subscriber.
+************************************************************************************/
+Std_ReturnType SysTick_ChangePeriod(uint32 Tick_Time_Us)
+{
+    Std_ReturnType result = E_OK;
+    uint32 Reload_Value = (SYSTICK_COUNTS_PER_US * Tick_Time_Us) - 1;
+    uint32 Elapsed_Counts;
+
+    /* One interrupt period not shorter than the SysTick_Start one, the subscribers count the SysTick_Start periods */
+    if((0U == Tick_Time_Us) || (SYSTICK_MAX_TICK_TIME_US < Tick_Time_Us) || (1U != g_SysTick_Extension)
+       || ((Reload_Value + 1) < g_SysTick_Base_Counts))
+    {
+        result = E_NOT_OK;
+    }
+    else
+    {
+        /* Freeze the counter to read exactly how many counts passed since the last interrupt */
+        SYSTICK_CTRL_REG &= ~SYSTICK_ENABLE_MASK;
+        Elapsed_Counts = (SYSTICK_RELOAD_REG - SYSTICK_CURRENT_REG) + 1 + SYSTICK_STOPPED_COUNTS;
+
+        /* The first period only counts what is left until Tick_Time_Us after the last interrupt */
+        if(Elapsed_Counts < Reload_Value)
+        {
+            SYSTICK_RELOAD_REG = Reload_Value - Elapsed_Counts;
+        }
+        else
+        {
+            /* Already late ... expire as soon as possible */
+            SYSTICK_RELOAD_REG = 1;
+        }
+        SYSTICK_CURRENT_REG = 0;
+        SYSTICK_CTRL_REG |= SYSTICK_ENABLE_MASK;
+
+        /* The counter already loaded the first period, the next periods use the full Reload value */
+        SYSTICK_RELOAD_REG = Reload_Value;
+
+        g_SysTick_Periods = (uint16)((Reload_Value + 1) / g_SysTick_Base_Counts);
+    }
+    return result;
+}
+
+/************************************************************************************
+* Service Name: SysTick_GetElapsedTimeUs
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Time in microseconds since the last SysTick interrupt
+* Description: Function to read the time elapsed in the running SysTick period.
+*              If the timer already expired but its interrupt is not served yet
+*              (interrupts masked or a higher priority ISR running) the expired
+*              period is included, so the result never goes backwards. The
+*              interrupts already counted by the software extension are added,
+*              the registers are read again if one of them is served meanwhile.
+************************************************************************************/
+uint32 SysTick_GetElapsedTimeUs(void)
+{
+    uint32 Extension_Count;
+    uint32 Current_Value;
+    uint32 Elapsed_Counts;
+
+    /* An interrupt served between the count and the CURRENT reads would pair the old count with the reloaded counter */
+    do
+    {
+        Extension_Count = g_SysTick_Extension_Count;
+        Current_Value = SYSTICK_CURRENT_REG;
+
+        if((NVIC_INT_CTRL_REG & SYSTICK_PENDING_MASK) != 0)
+        {
+            /* The counter reloaded since the interrupt was raised ... read it again after the reload */
+            Current_Value  = SYSTICK_CURRENT_REG;
+            Elapsed_Counts = (SYSTICK_RELOAD_REG - Current_Value) + (SYSTICK_RELOAD_REG + 1);
+        }
+        else
+        {
+            /* The RELOAD register holds the full period also while SysTick_ChangePeriod shortens the first one */
+            Elapsed_Counts = SYSTICK_RELOAD_REG - Current_Value;
+        }
+    } while(Extension_Count != g_SysTick_Extension_Count);
+    /* Below SYSTICK_MAX_START_CYCLES plus one interrupt period ... no overflow */
+    Elapsed_Counts += Extension_Count * (SYSTICK_RELOAD_REG + 1);
+    return (Elapsed_Counts / SYSTICK_COUNTS_PER_US);
+}
+
+/* Base address of every timer module */
+static const uint32 Gpt_TimerBaseAddress[GPT_TIMERS_NUM] =
+{
+    GPT_TIMER0_BASE_ADDRESS,  GPT_TIMER1_BASE_ADDRESS,  GPT_TIMER2_BASE_ADDRESS,
+    GPT_TIMER3_BASE_ADDRESS,  GPT_TIMER4_BASE_ADDRESS,  GPT_TIMER5_BASE_ADDRESS,
+    GPT_WTIMER0_BASE_ADDRESS, GPT_WTIMER1_BASE_ADDRESS, GPT_WTIMER2_BASE_ADDRESS,
+    GPT_WTIMER3_BASE_ADDRESS, GPT_WTIMER4_BASE_ADDRESS, GPT_WTIMER5_BASE_ADDRESS
+};
+
+/* Interrupt number of timer A of every timer module */
+static const uint8 Gpt_TimerIrqNumber[GPT_TIMERS_NUM] =
+{
+    19, 21, 23, 35, 70, 92,
+    94, 96, 98, 100, 102, 104
+};
+
+/* Register of a timer module */
+#define GPT_TIMER_REG(TIMER, OFFSET)   (*(volatile uint32 *)(Gpt_TimerBaseAddress[(TIMER)] + (OFFSET)))
+
+/* Bit of the predefined timer module in the wide timers clock gating registers */
+#define GPT_PREDEF_TIMER_MODULE        (GPT_PREDEF_TIMER_WTIMER - GPT_WTIMER_0)
+
+/************************************************************************************
+* Service Name: Gpt_HwInit
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Channel - Configuration of the channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set up the timer of a channel:
+*              - Enable the timer module clock
+*              - 32-bit timer counting down in one-shot or periodic mode
+*              - Enable the timeout interrupt and set its priority
+************************************************************************************/
+void Gpt_HwInit(const Gpt_ConfigChannel * Channel)
+{
+    Gpt_TimerType timer = Channel->Timer;
+    uint8 irq = Gpt_TimerIrqNumber[timer];
+    uint8 module;
+
+    /* Enable the clock of the timer module and wait until it is ready */
+    if(timer < GPT_WTIMER_0)
+    {
+        module = timer;
+        SET_BIT(SYSCTL_RCGCTIMER_REG, module);
+        while(BIT_IS_CLEAR(SYSCTL_PRTIMER_REG, module));
+    }
+    else
+    {
+        module = timer - GPT_WTIMER_0;
+        SET_BIT(SYSCTL_RCGCWTIMER_REG, module);
+        while(BIT_IS_CLEAR(SYSCTL_PRWTIMER_REG, module));
+    }
+
+    /* The timer is disabled while it is configured */
+    GPT_TIMER_REG(timer, GPT_CTL_REG_OFFSET) = 0;
+    GPT_TIMER_REG(timer, GPT_CFG_REG_OFFSET) = (timer < GPT_WTIMER_0) ? GPT_CFG_32_BIT_TIMER : GPT_CFG_32_BIT_WIDE_TIMER;
+    GPT_TIMER_REG(timer, GPT_TAMR_REG_OFFSET) = (GPT_CH_MODE_ONESHOT == Channel->Mode) ? GPT_TAMR_ONE_SHOT : GPT_TAMR_PERIODIC;
+
+    /* Enable the timeout interrupt */
+    GPT_TIMER_REG(timer, GPT_ICR_REG_OFFSET) = GPT_TATO_MASK;
+    GPT_TIMER_REG(timer, GPT_IMR_REG_OFFSET) = GPT_TATO_MASK;
+    *(volatile uint8 *)(NVIC_PRI_BASE_ADDRESS + irq) = (uint8)(Channel->Priority << NVIC_PRIORITY_BITS_POS);
+    *(volatile uint32 *)(NVIC_EN_BASE_ADDRESS + ((irq / 32U) * 4U)) = (1UL << (irq % 32U));
+}
+
+/************************************************************************************
+* Service Name: Gpt_HwDeInit
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Channel - Configuration of the channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop the timer of a channel and disable its interrupt.
+************************************************************************************/
+void Gpt_HwDeInit(const Gpt_ConfigChannel * Channel)
+{
+    Gpt_TimerType timer = Channel->Timer;
+    uint8 irq = Gpt_TimerIrqNumber[timer];
+
+    GPT_TIMER_REG(timer, GPT_CTL_REG_OFFSET) = 0;
+    GPT_TIMER_REG(timer, GPT_IMR_REG_OFFSET) = 0;
+    GPT_TIMER_REG(timer, GPT_ICR_REG_OFFSET) = GPT_TATO_MASK;
+    *(volatile uint32 *)(NVIC_DIS_BASE_ADDRESS + ((irq / 32U) * 4U)) = (1UL << (irq % 32U));
+}
+
+/************************************************************************************
+* Service Name: Gpt_HwStart
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Configuration of the channel
+*                  Value   - Target time in number of ticks
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start the timer of a channel from Value - 1 down to 0.
+************************************************************************************/
+void Gpt_HwStart(const Gpt_ConfigChannel * Channel, Gpt_ValueType Value)
+{
+    Gpt_TimerType timer = Channel->Timer;
+
+    GPT_TIMER_REG(timer, GPT_CTL_REG_OFFSET)   = 0;
+    /* Writing the load register also loads the counter */
+    GPT_TIMER_REG(timer, GPT_TAILR_REG_OFFSET) = Value - 1U;
+    GPT_TIMER_REG(timer, GPT_ICR_REG_OFFSET)   = GPT_TATO_MASK;
+    /* The timer stops while the debugger halts the core */
+    GPT_TIMER_REG(timer, GPT_CTL_REG_OFFSET)   = GPT_CTL_TAEN_MASK | GPT_CTL_TASTALL_MASK;
+}
+
+/************************************************************************************
+* Service Name: Gpt_HwStop
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Configuration of the channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop the timer of a channel, the counter keeps its value.
+************************************************************************************/
+void Gpt_HwStop(const Gpt_ConfigChannel * Channel)
+{
+    CLEAR_BIT(GPT_TIMER_REG(Channel->Timer, GPT_CTL_REG_OFFSET), 0);
+}
+
+/************************************************************************************
+* Service Name: Gpt_HwGetElapsed
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Configuration of the channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Gpt_ValueType - Ticks since the start or the last expiry
+* Description: Function to read the timer of a channel. A one-shot timer stops at the
+*              expiry and raises its interrupt flag, its whole period is elapsed even
+*              if the interrupt is not served yet.
+************************************************************************************/
+Gpt_ValueType Gpt_HwGetElapsed(const Gpt_ConfigChannel * Channel)
+{
+    Gpt_TimerType timer = Channel->Timer;
+    Gpt_ValueType load = GPT_TIMER_REG(timer, GPT_TAILR_REG_OFFSET);
+    Gpt_ValueType elapsed;
+
+    if((GPT_CH_MODE_ONESHOT == Channel->Mode) && (BIT_IS_SET(GPT_TIMER_REG(timer, GPT_RIS_REG_OFFSET), 0)))
+    {
+        elapsed = load + 1U;
+    }
+    else
+    {
+        elapsed = load - GPT_TIMER_REG(timer, GPT_TAR_REG_OFFSET);
+    }
+    return elapsed;
+}
+
+/************************************************************************************
+* Service Name: Gpt_HwClearInterrupt
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Configuration of the channel
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
-* Description: Function to Setup the SysTick Timer call back
+* Description: Function to clear the timeout interrupt flag of the timer of a channel.
 ************************************************************************************/
-void SysTick_SetCallBack(void(*Ptr2Func)(void))
+void Gpt_HwClearInterrupt(const Gpt_ConfigChannel * Channel)
 {
-    g_SysTick_Call_Back_Ptr = Ptr2Func;
-}
\ No newline at end of file
+    GPT_TIMER_REG(Channel->Timer, GPT_ICR_REG_OFFSET) = GPT_TATO_MASK;
+}
+
+#if (GPT_PREDEF_TIMER_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_HwStartPredefTimer
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start the wide timer of the predefined timer in 64-bit
+*              periodic mode counting up from 0 to the 64-bit maximum, no interrupt.
+************************************************************************************/
+void Gpt_HwStartPredefTimer(void)
+{
+    SET_BIT(SYSCTL_RCGCWTIMER_REG, GPT_PREDEF_TIMER_MODULE);
+    while(BIT_IS_CLEAR(SYSCTL_PRWTIMER_REG, GPT_PREDEF_TIMER_MODULE));
+
+    GPT_TIMER_REG(GPT_PREDEF_TIMER_WTIMER, GPT_CTL_REG_OFFSET)   = 0;
+    GPT_TIMER_REG(GPT_PREDEF_TIMER_WTIMER, GPT_CFG_REG_OFFSET)   = GPT_CFG_64_BIT_WIDE_TIMER;
+    GPT_TIMER_REG(GPT_PREDEF_TIMER_WTIMER, GPT_TAMR_REG_OFFSET)  = GPT_TAMR_PERIODIC | GPT_TAMR_COUNT_UP_MASK;
+    GPT_TIMER_REG(GPT_PREDEF_TIMER_WTIMER, GPT_TAILR_REG_OFFSET) = 0xFFFFFFFF;
+    GPT_TIMER_REG(GPT_PREDEF_TIMER_WTIMER, GPT_TBILR_REG_OFFSET) = 0xFFFFFFFF;
+    GPT_TIMER_REG(GPT_PREDEF_TIMER_WTIMER, GPT_IMR_REG_OFFSET)   = 0;
+    /* The timer stops while the debugger halts the core, as the cycle counter of the Os timestamps */
+    GPT_TIMER_REG(GPT_PREDEF_TIMER_WTIMER, GPT_CTL_REG_OFFSET)   = GPT_CTL_TAEN_MASK | GPT_CTL_TASTALL_MASK;
+}
+
+/************************************************************************************
+* Service Name: Gpt_HwStopPredefTimer
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop the wide timer of the predefined timer.
+************************************************************************************/
+void Gpt_HwStopPredefTimer(void)
+{
+    GPT_TIMER_REG(GPT_PREDEF_TIMER_WTIMER, GPT_CTL_REG_OFFSET) = 0;
+}
+
+/************************************************************************************
+* Service Name: Gpt_HwGetPredefTimer
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint64 - Predefined timer value in ticks
+* Description: Function to read the 64-bit counter of the predefined timer. The high
+*              word is read before and after the low word: if it changed, the low word
+*              wrapped around meanwhile and is read again with the new high word, so
+*              the read needs no interrupt masking and an ISR can read it any time.
+************************************************************************************/
+uint64 Gpt_HwGetPredefTimer(void)
+{
+    uint32 high = GPT_TIMER_REG(GPT_PREDEF_TIMER_WTIMER, GPT_TBV_REG_OFFSET);
+    uint32 low  = GPT_TIMER_REG(GPT_PREDEF_TIMER_WTIMER, GPT_TAV_REG_OFFSET);
+    uint32 high_after = GPT_TIMER_REG(GPT_PREDEF_TIMER_WTIMER, GPT_TBV_REG_OFFSET);
+
+    if(high_after != high)
+    {
+        high = high_after;
+        low  = GPT_TIMER_REG(GPT_PREDEF_TIMER_WTIMER, GPT_TAV_REG_OFFSET);
+    }
+    return (((uint64)high) << 32) | low;
+}
+#endif
+
+/************************************************************************************
+* Service Name: TIMERxA_Handler / WTIMERxA_Handler
+* Description: Timer A ISRs of the timer modules
+************************************************************************************/
+void TIMER0A_Handler(void)  { Gpt_TimerIsr(GPT_TIMER_0);  }
+void TIMER1A_Handler(void)  { Gpt_TimerIsr(GPT_TIMER_1);  }
+void TIMER2A_Handler(void)  { Gpt_TimerIsr(GPT_TIMER_2);  }
+void TIMER3A_Handler(void)  { Gpt_TimerIsr(GPT_TIMER_3);  }
+void TIMER4A_Handler(void)  { Gpt_TimerIsr(GPT_TIMER_4);  }
+void TIMER5A_Handler(void)  { Gpt_TimerIsr(GPT_TIMER_5);  }
+void WTIMER0A_Handler(void) { Gpt_TimerIsr(GPT_WTIMER_0); }
+void WTIMER1A_Handler(void) { Gpt_TimerIsr(GPT_WTIMER_1); }
+void WTIMER2A_Handler(void) { Gpt_TimerIsr(GPT_WTIMER_2); }
+void WTIMER3A_Handler(void) { Gpt_TimerIsr(GPT_WTIMER_3); }
+void WTIMER4A_Handler(void) { Gpt_TimerIsr(GPT_WTIMER_4); }
+void WTIMER5A_Handler(void) { Gpt_TimerIsr(GPT_WTIMER_5); }
+
+#endif /* !defined(__linux__) || defined(GPT_SIM) */
@@ -4,7 +4,13 @@
  *
  * File Name: Gpt.h
  *
- * Description: Header file for TM4C123GH6PM Microcontroller - SysTick Timer Driver.
+ * Description: Header file for TM4C123GH6PM Microcontroller - Gpt Driver.
+ *              The Gpt channels run on the general purpose timers TIMER0-5 (32-bit
+ *              concatenated mode) and the wide timers WTIMER0-5 (32-bit timer A) in
+ *              one-shot or continuous mode, the SysTick Timer keeps the Os tick.
+ *              The predefined timer is a wide timer in 64-bit mode counting up.
+ *              Gpt.c drives the registers, Gpt_Host.c implements the same timers on
+ *              Linux with a virtual or real time source for host builds.
  *
  * Author: Mohamed Tarek
  ******************************************************************************/
@@ -12,26 +18,348 @@
 #ifndef GPT_H
 #define GPT_H
 
+/* Id for the company in the AUTOSAR
+ * for example Mohamed Tarek's ID = 1000 :) */
+#define GPT_VENDOR_ID    (1000U)
+
+/* Gpt Module Id */
+#define GPT_MODULE_ID    (100U)
+
+/* Gpt Instance Id */
+#define GPT_INSTANCE_ID  (0U)
+
+/*
+ * Module Version 1.0.0
+ */
+#define GPT_SW_MAJOR_VERSION           (1U)
+#define GPT_SW_MINOR_VERSION           (0U)
+#define GPT_SW_PATCH_VERSION           (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define GPT_AR_RELEASE_MAJOR_VERSION   (4U)
+#define GPT_AR_RELEASE_MINOR_VERSION   (0U)
+#define GPT_AR_RELEASE_PATCH_VERSION   (3U)
+
+/*
+ * Macros for Gpt Status
+ */
+#define GPT_INITIALIZED                (1U)
+#define GPT_NOT_INITIALIZED            (0U)
+
+/* Standard AUTOSAR types */
 #include "Std_Types.h"
 
+/* AUTOSAR checking between Std Types and Gpt Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != GPT_AR_RELEASE_MAJOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_MINOR_VERSION != GPT_AR_RELEASE_MINOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_PATCH_VERSION != GPT_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* Core clock of the Mcu Driver counted by the timers (MCU_CORE_CLOCK_HZ) */
+#include "Mcu.h"
+
+/* Gpt Pre-Compile Configuration Header file */
+#include "Gpt_Cfg.h"
+
+/* AUTOSAR Version checking between Gpt_Cfg.h and Gpt.h files */
+#if ((GPT_CFG_AR_RELEASE_MAJOR_VERSION != GPT_AR_RELEASE_MAJOR_VERSION)\
+ ||  (GPT_CFG_AR_RELEASE_MINOR_VERSION != GPT_AR_RELEASE_MINOR_VERSION)\
+ ||  (GPT_CFG_AR_RELEASE_PATCH_VERSION != GPT_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Gpt_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Gpt_Cfg.h and Gpt.h files */
+#if ((GPT_CFG_SW_MAJOR_VERSION != GPT_SW_MAJOR_VERSION)\
+ ||  (GPT_CFG_SW_MINOR_VERSION != GPT_SW_MINOR_VERSION)\
+ ||  (GPT_CFG_SW_PATCH_VERSION != GPT_SW_PATCH_VERSION))
+  #error "The SW version of Gpt_Cfg.h does not match the expected version"
+#endif
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for GPT GetVersionInfo */
+#define GPT_GET_VERSION_INFO_SID       (uint8)0x00
+
+/* Service ID for GPT Init */
+#define GPT_INIT_SID                   (uint8)0x01
+
+/* Service ID for GPT DeInit */
+#define GPT_DEINIT_SID                 (uint8)0x02
+
+/* Service ID for GPT GetTimeElapsed */
+#define GPT_GET_TIME_ELAPSED_SID       (uint8)0x03
+
+/* Service ID for GPT GetTimeRemaining */
+#define GPT_GET_TIME_REMAINING_SID     (uint8)0x04
+
+/* Service ID for GPT StartTimer */
+#define GPT_START_TIMER_SID            (uint8)0x05
+
+/* Service ID for GPT StopTimer */
+#define GPT_STOP_TIMER_SID             (uint8)0x06
+
+/* Service ID for GPT EnableNotification */
+#define GPT_ENABLE_NOTIFICATION_SID    (uint8)0x07
+
+/* Service ID for GPT DisableNotification */
+#define GPT_DISABLE_NOTIFICATION_SID   (uint8)0x08
+
+/* Service ID for GPT GetPredefTimerValue */
+#define GPT_GET_PREDEF_TIMER_VALUE_SID (uint8)0x0D
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* API service called without module initialization */
+#define GPT_E_UNINIT                   (uint8)0x0A
+
+/* Gpt_StartTimer called for a running channel or Gpt_DeInit called while a channel is running */
+#define GPT_E_BUSY                     (uint8)0x0B
+
+/* Gpt_Init called while the driver is already initialized */
+#define GPT_E_ALREADY_INITIALIZED      (uint8)0x0D
+
+/* Gpt_Init API service called with NULL pointer parameter */
+#define GPT_E_PARAM_CONFIG             (uint8)0x0E
+
+/* DET code to report Invalid Channel, or a notification service for a channel without notification */
+#define GPT_E_PARAM_CHANNEL            (uint8)0x14
+
+/* Gpt_StartTimer called with a 0 target time */
+#define GPT_E_PARAM_VALUE              (uint8)0x15
+
+/* Gpt_GetVersionInfo or Gpt_GetPredefTimerValue called with NULL pointer parameter */
+#define GPT_E_PARAM_POINTER            (uint8)0x16
+
+/* Gpt_GetPredefTimerValue called with an invalid predefined timer */
+#define GPT_E_PARAM_PREDEF_TIMER       (uint8)0x17
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for Gpt_ChannelType used by the GPT APIs */
+typedef uint8 Gpt_ChannelType;
+
+/* Type definition for Gpt_ValueType used by the GPT APIs ... time in channel ticks */
+typedef uint32 Gpt_ValueType;
+
+/* Type definition for Gpt_TimerType ... hardware timer of a channel */
+typedef uint8 Gpt_TimerType;
+
+/* Gpt Timers, timer A of every timer module */
+#define GPT_TIMER_0                    (Gpt_TimerType)0
+#define GPT_TIMER_1                    (Gpt_TimerType)1
+#define GPT_TIMER_2                    (Gpt_TimerType)2
+#define GPT_TIMER_3                    (Gpt_TimerType)3
+#define GPT_TIMER_4                    (Gpt_TimerType)4
+#define GPT_TIMER_5                    (Gpt_TimerType)5
+#define GPT_WTIMER_0                   (Gpt_TimerType)6
+#define GPT_WTIMER_1                   (Gpt_TimerType)7
+#define GPT_WTIMER_2                   (Gpt_TimerType)8
+#define GPT_WTIMER_3                   (Gpt_TimerType)9
+#define GPT_WTIMER_4                   (Gpt_TimerType)10
+#define GPT_WTIMER_5                   (Gpt_TimerType)11
+
+/* Number of the Gpt Timers */
+#define GPT_TIMERS_NUM                 (12U)
+
+/* Type definition for Gpt_ChannelModeType */
+typedef enum
+{
+    GPT_CH_MODE_CONTINUOUS,     /* The channel restarts at every expiry */
+    GPT_CH_MODE_ONESHOT         /* The channel stops at the expiry */
+} Gpt_ChannelModeType;
+
+/* Type definition for Gpt_PredefTimerType ... resolution and width of a predefined timer value */
+typedef enum
+{
+    GPT_PREDEF_TIMER_1US_16BIT,
+    GPT_PREDEF_TIMER_1US_24BIT,
+    GPT_PREDEF_TIMER_1US_32BIT,
+    GPT_PREDEF_TIMER_100US_32BIT
+} Gpt_PredefTimerType;
+
+/* Type definition for the channel notifications, called in the timer interrupt */
+typedef void (*Gpt_NotificationType)(void);
+
+typedef struct
+{
+	/* Member contains the hardware timer of the channel */
+	Gpt_TimerType Timer;
+	/* Member contains the mode of the channel */
+	Gpt_ChannelModeType Mode;
+	/* Member contains the priority of the timer interrupt, 0 (highest) to 7 */
+	uint8 Priority;
+	/* Member contains the notification called at every expiry, or NULL_PTR */
+	Gpt_NotificationType Notification;
+} Gpt_ConfigChannel;
+
+/* Data Structure required for initializing the Gpt Driver */
+typedef struct Gpt_ConfigType
+{
+	Gpt_ConfigChannel Channels[GPT_CONFIGURED_CHANNELS];
+} Gpt_ConfigType;
+
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
 
+/* Function for GPT Initialization API, the channels are stopped with their notification disabled */
+void Gpt_Init(const Gpt_ConfigType * ConfigPtr);
+
+#if (GPT_DEINIT_API == STD_ON)
+/* Function for GPT DeInitialization API */
+void Gpt_DeInit(void);
+#endif
+
+#if (GPT_TIME_ELAPSED_API == STD_ON)
+/* Function for GPT time elapsed API ... ticks since the channel started or restarted */
+Gpt_ValueType Gpt_GetTimeElapsed(Gpt_ChannelType Channel);
+#endif
+
+#if (GPT_TIME_REMAINING_API == STD_ON)
+/* Function for GPT time remaining API ... ticks until the next expiry of the channel */
+Gpt_ValueType Gpt_GetTimeRemaining(Gpt_ChannelType Channel);
+#endif
+
+/* Function for GPT start timer API ... the channel expires after Value ticks */
+void Gpt_StartTimer(Gpt_ChannelType Channel, Gpt_ValueType Value);
+
+/* Function for GPT stop timer API */
+void Gpt_StopTimer(Gpt_ChannelType Channel);
+
+#if (GPT_ENABLE_DISABLE_NOTIFICATION_API == STD_ON)
+/* Function for GPT enable notification API */
+void Gpt_EnableNotification(Gpt_ChannelType Channel);
+
+/* Function for GPT disable notification API */
+void Gpt_DisableNotification(Gpt_ChannelType Channel);
+#endif
+
+/* Function for GPT Get Version Info API */
+#if (GPT_VERSION_INFO_API == STD_ON)
+void Gpt_GetVersionInfo(Std_VersionInfoType *versioninfo);
+#endif
+
+#if (GPT_PREDEF_TIMER_API == STD_ON)
+/* Function for GPT get predefined timer value API ... microseconds since Gpt_Init, truncated to the timer width */
+Std_ReturnType Gpt_GetPredefTimerValue(Gpt_PredefTimerType PredefTimer, uint32 * TimeValuePtr);
+
+/* Function to read the 64-bit predefined timer ... ticks of GPT_TICK_FREQUENCY since Gpt_Init, 0 before, callable from ISRs */
+uint64 Gpt_GetPredefTimerValue64(void);
+#endif
+
+/*******************************************************************************
+ *          Timer Hardware Functions (used by the Gpt services only)           *
+ *******************************************************************************/
+
+/* Description: Enable the timer clock and set the mode and the interrupt of a channel, the timer is stopped */
+void Gpt_HwInit(const Gpt_ConfigChannel * Channel);
+
+/* Description: Stop the timer of a channel and disable its interrupt */
+void Gpt_HwDeInit(const Gpt_ConfigChannel * Channel);
+
+/* Description: Start the timer of a channel, it expires after Value ticks (and every Value ticks in continuous mode) */
+void Gpt_HwStart(const Gpt_ConfigChannel * Channel, Gpt_ValueType Value);
+
+/* Description: Stop the timer of a channel */
+void Gpt_HwStop(const Gpt_ConfigChannel * Channel);
+
+/* Description: Return the ticks since the start or the last expiry, the whole period once a one-shot channel expired */
+Gpt_ValueType Gpt_HwGetElapsed(const Gpt_ConfigChannel * Channel);
+
+/* Description: Clear the timeout interrupt of a channel */
+void Gpt_HwClearInterrupt(const Gpt_ConfigChannel * Channel);
+
+/* Description: Start the predefined timer counting up from 0 */
+void Gpt_HwStartPredefTimer(void);
+
+/* Description: Stop the predefined timer */
+void Gpt_HwStopPredefTimer(void);
+
+/* Description: Return the predefined timer value in ticks, the 64 bits are read consistently without masking the interrupts */
+uint64 Gpt_HwGetPredefTimer(void);
+
+/* Description: Timeout interrupt of a timer, called by the interrupt handler of the timer */
+void Gpt_TimerIsr(Gpt_TimerType Timer);
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Extern PB structures to be used by Gpt and other modules */
+extern const Gpt_ConfigType Gpt_Configuration;
+
+/*******************************************************************************
+ *                          SysTick Timer (Os tick)                            *
+ *******************************************************************************/
+
+/* SysTick counts (core cycles) in one microsecond */
+#define SYSTICK_COUNTS_PER_US       (MCU_CORE_CLOCK_HZ / 1000000UL)
+
+/* Counts of the longest SysTick interrupt period ... the 24-bit reload register */
+#define SYSTICK_MAX_RELOAD_COUNTS   (0x1000000UL)
+
+/* Longest period of one SysTick interrupt in microseconds (209715 at 80Mhz), the limit of SysTick_ChangePeriod */
+#define SYSTICK_MAX_TICK_TIME_US    (SYSTICK_MAX_RELOAD_COUNTS / SYSTICK_COUNTS_PER_US)
+
+/*
+ * Most SysTick interrupts counted in software for one SysTick_Start period. A longer period
+ * is split in equal interrupt periods that fit the reload register, the subscribers are
+ * called at the last one.
+ */
+#define SYSTICK_MAX_EXTENSION       (255U)
+
+/*
+ * Longest SysTick_Start period in microseconds (16.7s): split in SYSTICK_COUNTS_PER_US
+ * interrupts of Tick_Time_Us counts each, any shorter period has an exact split too.
+ */
+#define SYSTICK_MAX_START_TIME_US   (SYSTICK_MAX_RELOAD_COUNTS)
+
+/* Longest SysTick_StartCycles period in core cycles, the one of SYSTICK_MAX_START_TIME_US */
+#define SYSTICK_MAX_START_CYCLES    (SYSTICK_MAX_START_TIME_US * SYSTICK_COUNTS_PER_US)
+
+#if (SYSTICK_COUNTS_PER_US > SYSTICK_MAX_EXTENSION)
+#error "SYSTICK_MAX_START_TIME_US needs SYSTICK_COUNTS_PER_US software extension steps"
+#endif
+
 /************************************************************************************
 * Service Name: SysTick_Start
 * Sync/Async: Synchronous
 * Reentrancy: reentrant
-* Parameters (in): Tick_Time - Time in miliseconds
+* Parameters (in): Tick_Time_Us - Time in microseconds (1 up to SYSTICK_MAX_START_TIME_US)
 * Parameters (inout): None
 * Parameters (out): None
-* Return value: None
-* Description: Function to Setup the SysTick Timer configuration to count n miliseconds:
+* Return value: Std_ReturnType - E_OK: the SysTick Timer is started
+*                                E_NOT_OK: Tick_Time_Us out of range, the timer is not changed
+* Description: Function to start the SysTick Timer with a period of n microseconds,
+*              see SysTick_StartCycles.
+************************************************************************************/
+Std_ReturnType SysTick_Start(uint32 Tick_Time_Us);
+
+/************************************************************************************
+* Service Name: SysTick_StartCycles
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Tick_Cycles - Time in core cycles (2 up to SYSTICK_MAX_START_CYCLES)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK: the SysTick Timer is started
+*                                E_NOT_OK: Tick_Cycles out of range or no exact split in SYSTICK_MAX_EXTENSION
+*                                          interrupts of SYSTICK_MAX_RELOAD_COUNTS counts at most,
+*                                          the timer is not changed
+* Description: Function to Setup the SysTick Timer configuration to count n core cycles:
+*              - Split the period in the fewest equal interrupt periods fitting the reload register
 *              - Set the Reload value
-*              - Enable SysTick Timer with System clock 16Mhz
+*              - Enable SysTick Timer with the System clock (MCU_CORE_CLOCK_HZ)
 *              - Enable SysTick Timer Interrupt and set its priority
-************************************************************************************/	
-void SysTick_Start(uint16 Tick_Time);
+************************************************************************************/
+Std_ReturnType SysTick_StartCycles(uint32 Tick_Cycles);
 
 /************************************************************************************
 * Service Name: SysTick_Stop
@@ -46,15 +374,81 @@ void SysTick_Start(uint16 Tick_Time);
 void SysTick_Stop(void);
 
 /************************************************************************************
-* Service Name: SysTick_SetCallBack
+* Service Name: SysTick_ChangePeriod
 * Sync/Async: Synchronous
-* Reentrancy: reentrant
+* Reentrancy: Non reentrant
+* Parameters (in): Tick_Time_Us - Time in microseconds (1 up to SYSTICK_MAX_TICK_TIME_US)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK: the period is changed
+*                                E_NOT_OK: Tick_Time_Us out of range, shorter than the SysTick_Start
+*                                          period or this one is extended in software,
+*                                          the period is not changed
+* Description: Function to change the period of the running SysTick Timer, the next
+*              interrupt fires Tick_Time_Us after the last one without losing the counts
+*              already elapsed. It shall be called from a SysTick subscriber.
+************************************************************************************/
+Std_ReturnType SysTick_ChangePeriod(uint32 Tick_Time_Us);
+
+/************************************************************************************
+* Service Name: SysTick_GetElapsedTimeUs
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Time in microseconds since the last SysTick interrupt calling the subscribers
+* Description: Function to read the time elapsed in the running SysTick period,
+*              including the expired period if its interrupt is not served yet.
+************************************************************************************/
+uint32 SysTick_GetElapsedTimeUs(void);
+
+/************************************************************************************
+* Service Name: SysTick_Subscribe
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
 * Parameters (in): Ptr2Func - Call Back function address
+*                  Divider - The call back is called every Divider SysTick periods
 * Parameters (inout): None
 * Parameters (out): None
-* Return value: None
-* Description: Function to Setup the SysTick Timer call back
+* Return value: Std_ReturnType - E_OK: the call back is registered
+*                                E_NOT_OK: NULL call back, Divider 0 or SYSTICK_MAX_SUBSCRIBERS reached
+* Description: Function to register a SysTick Timer call back. The call backs are called
+*              in the order of their dividers (the same dividers in the registration order),
+*              the periods are the ones of SysTick_Start even if SysTick_ChangePeriod
+*              lengthens the interrupts period.
 ************************************************************************************/
-void SysTick_SetCallBack(void (*Ptr2Func)(void));
+Std_ReturnType SysTick_Subscribe(void (*Ptr2Func)(void), uint16 Divider);
+
+#if (SYSTICK_ISR_STATS == STD_ON)
+/* Description: Return the longest SysTick interrupt duration in timestamp counts (CPU cycles on the target) */
+uint32 SysTick_GetMaxIsrTime(void);
+
+/* Description: Restart the measurement of the longest SysTick interrupt duration */
+void SysTick_ResetMaxIsrTime(void);
+#endif
+
+/* Description: SysTick interrupt, called by the interrupt handler with the SysTick periods elapsed since the last one */
+void SysTick_Isr(uint16 Periods);
+
+#if defined(__linux__)
+
+/* Time sources of the host SysTick Timer */
+#define SYSTICK_HOST_VIRTUAL_TIME   (0U)    /* The time jumps to the next expiry, as fast as the host runs */
+#define SYSTICK_HOST_REAL_TIME      (1U)    /* The expiries follow CLOCK_MONOTONIC using a timerfd */
+
+/* Description: Select the time source of the host SysTick Timer (SYSTICK_HOST_VIRTUAL_TIME by default) */
+void SysTick_HostSetMode(uint8 Mode);
+
+/* Description: Exit the process with EXIT_SUCCESS instead of delivering the first interrupt after Stop_Time_Us (0 runs forever) */
+void SysTick_HostSetStopTime(uint64 Stop_Time_Us);
+
+/* Description: Return the host time in microseconds since the first SysTick_Start */
+uint64 SysTick_HostGetTimeUs(void);
+
+/* Description: Wait for the next expiry of the host SysTick Timer or Gpt timers and run its interrupt */
+void SysTick_WaitForInterrupt(void);
+
+#endif
 
 #endif /* GPT_H */
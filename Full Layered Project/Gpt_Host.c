@@ -0,0 +1,522 @@
+ /******************************************************************************
+ *
+ * Module: Gpt
+ *
+ * File Name: Gpt_Host.c
+ *
+ * Description: Source file for the Gpt Driver timers - Linux host backend.
+ *              The SysTick and Gpt timers interrupts are delivered by
+ *              SysTick_WaitForInterrupt, called from the Os idle loop, using one of two
+ *              time sources:
+ *              - Virtual time: the time jumps directly to the next expiry, so hours
+ *                of schedule run in seconds.
+ *              - Real time: the caller sleeps on a timerfd until the expiry.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Gpt.h"
+
+/* Trace of the SysTick interrupt */
+#include "Os_Trace.h"
+
+#if defined(__linux__) && !defined(GPT_SIM)
+
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/timerfd.h>
+
+/* Gpt channel ticks in one microsecond of host time */
+#define GPT_HOST_TICKS_PER_US       (GPT_TICK_FREQUENCY / 1000000UL)
+
+/* No timer expires before the SysTick */
+#define GPT_HOST_NO_TIMER           (0xFFU)
+
+/* State of a host Gpt timer, the time is in channel ticks of host time */
+typedef struct
+{
+    boolean Running;
+    Gpt_ChannelModeType Mode;
+    uint64 Start_Tick;      /* Start or last expiry */
+    Gpt_ValueType Period;
+} Gpt_HostTimerType;
+
+/* Period of SysTick_Start in microseconds */
+static uint64 g_Base_Period_Us = 1;
+
+/* Time source, SYSTICK_HOST_VIRTUAL_TIME or SYSTICK_HOST_REAL_TIME */
+static uint8 g_Host_Mode = SYSTICK_HOST_VIRTUAL_TIME;
+
+/* TRUE between SysTick_Start and SysTick_Stop */
+static boolean g_SysTick_Running = FALSE;
+
+/* Host time in microseconds since the first SysTick_Start, it only moves at the expiries in the virtual time */
+static uint64 g_Host_Time_Us = 0;
+
+/* SysTick period, last expiry and next expiry in microseconds of host time */
+static uint64 g_Period_Us = 0;
+static uint64 g_Last_Expiry_Us = 0;
+static uint64 g_Next_Expiry_Us = 0;
+
+/* Host time ending the simulation, 0 to run forever */
+static uint64 g_Stop_Time_Us = 0;
+
+/* Host Gpt timers */
+static Gpt_HostTimerType g_Gpt_Timers[GPT_TIMERS_NUM];
+
+/* Host time in channel ticks when the predefined timer started */
+static uint64 g_Predef_Start_Tick = 0;
+
+/* Timer used by the real time mode and the CLOCK_MONOTONIC time of the host time 0 */
+static int g_Timer_Fd = -1;
+static uint64 g_Real_Time_Base_Us = 0;
+static boolean g_Real_Time_Base_Set = FALSE;
+
+/*********************************************************************************************/
+/* Description: Read CLOCK_MONOTONIC in microseconds */
+static uint64 SysTick_HostMonotonicUs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64)now.tv_sec * 1000000ULL) + ((uint64)now.tv_nsec / 1000ULL);
+}
+
+/*********************************************************************************************/
+/* Description: Update the host time, in the real time mode it follows CLOCK_MONOTONIC */
+static uint64 SysTick_HostNow(void)
+{
+    if(g_Host_Mode == SYSTICK_HOST_REAL_TIME)
+    {
+        if(g_Real_Time_Base_Set == FALSE)
+        {
+            /* Keep the host time continuous when the mode changes */
+            g_Real_Time_Base_Us  = SysTick_HostMonotonicUs() - g_Host_Time_Us;
+            g_Real_Time_Base_Set = TRUE;
+        }
+        g_Host_Time_Us = SysTick_HostMonotonicUs() - g_Real_Time_Base_Us;
+    }
+    return g_Host_Time_Us;
+}
+
+/*********************************************************************************************/
+/* Description: Sleep on the timerfd until the host time reaches Expiry_Us */
+static void SysTick_HostSleepUntil(uint64 Expiry_Us)
+{
+    struct itimerspec expiry_time = {{0, 0}, {0, 0}};
+    uint64 expiry_monotonic_us = g_Real_Time_Base_Us + Expiry_Us;
+    uint64 expirations;
+
+    if(g_Timer_Fd < 0)
+    {
+        g_Timer_Fd = timerfd_create(CLOCK_MONOTONIC, 0);
+        if(g_Timer_Fd < 0)
+        {
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    /* Absolute expiry ... a time already passed fires immediately so a late tick is never lost */
+    expiry_time.it_value.tv_sec  = (time_t)(expiry_monotonic_us / 1000000ULL);
+    expiry_time.it_value.tv_nsec = (long)((expiry_monotonic_us % 1000000ULL) * 1000ULL);
+    (void)timerfd_settime(g_Timer_Fd, TFD_TIMER_ABSTIME, &expiry_time, NULL_PTR);
+    (void)read(g_Timer_Fd, &expirations, sizeof(expirations));
+}
+
+/*********************************************************************************************/
+/* Description: Return the host time in channel ticks, with the nanoseconds of CLOCK_MONOTONIC in the real time mode */
+static uint64 Gpt_HostNowTicks(void)
+{
+    struct timespec now;
+    uint64 now_ns;
+    uint64 ticks = SysTick_HostNow() * GPT_HOST_TICKS_PER_US;
+
+    if(g_Host_Mode == SYSTICK_HOST_REAL_TIME)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        now_ns = ((uint64)now.tv_sec * 1000000000ULL) + (uint64)now.tv_nsec - (g_Real_Time_Base_Us * 1000ULL);
+        ticks  = ((now_ns / 1000ULL) * GPT_HOST_TICKS_PER_US) + (((now_ns % 1000ULL) * GPT_HOST_TICKS_PER_US) / 1000ULL);
+    }
+    return ticks;
+}
+
+/*********************************************************************************************/
+/* Description: Return the host time in microseconds of the next expiry of a running Gpt timer */
+static uint64 Gpt_HostExpiryUs(const Gpt_HostTimerType * Timer)
+{
+    /* Rounded up, the interrupt is never delivered before the expiry */
+    return ((Timer->Start_Tick + Timer->Period) + (GPT_HOST_TICKS_PER_US - 1U)) / GPT_HOST_TICKS_PER_US;
+}
+
+/************************************************************************************
+* Service Name: SysTick_StartCycles
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Tick_Cycles - Time in core cycles (2 up to SYSTICK_MAX_START_CYCLES)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK: the host SysTick Timer is started
+*                                E_NOT_OK: Tick_Cycles out of range or not whole microseconds,
+*                                          the timer is not changed
+* Description: Function to start the host SysTick Timer with a period of n core cycles
+*              from the current host time. The host time counts microseconds and has no
+*              reload register, one interrupt is delivered every period.
+************************************************************************************/
+Std_ReturnType SysTick_StartCycles(uint32 Tick_Cycles)
+{
+    Std_ReturnType result = E_NOT_OK;
+
+    if((Tick_Cycles >= SYSTICK_COUNTS_PER_US) && (Tick_Cycles <= SYSTICK_MAX_START_CYCLES)
+       && ((Tick_Cycles % SYSTICK_COUNTS_PER_US) == 0U))
+    {
+        g_Period_Us       = Tick_Cycles / SYSTICK_COUNTS_PER_US;
+        g_Base_Period_Us  = g_Period_Us;
+        g_Last_Expiry_Us  = SysTick_HostNow();
+        g_Next_Expiry_Us  = g_Last_Expiry_Us + g_Period_Us;
+        g_SysTick_Running = TRUE;
+        result = E_OK;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+    return result;
+}
+
+/************************************************************************************
+* Service Name: SysTick_Stop
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to Stop the host SysTick Timer.
+************************************************************************************/
+void SysTick_Stop(void)
+{
+    g_SysTick_Running = FALSE;
+}
+
+/************************************************************************************
+* Service Name: SysTick_ChangePeriod
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Tick_Time_Us - Time in microseconds (1 up to SYSTICK_MAX_TICK_TIME_US)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK: the period is changed
+*                                E_NOT_OK: Tick_Time_Us out of range, shorter than the SysTick_Start
+*                                          period or this one is extended in software on the
+*                                          target, the period is not changed
+* Description: Function to change the period of the running host SysTick Timer, the
+*              next interrupt fires Tick_Time_Us after the last one.
+************************************************************************************/
+Std_ReturnType SysTick_ChangePeriod(uint32 Tick_Time_Us)
+{
+    Std_ReturnType result = E_NOT_OK;
+
+    if((0U != Tick_Time_Us) && (SYSTICK_MAX_TICK_TIME_US >= Tick_Time_Us)
+       && (SYSTICK_MAX_TICK_TIME_US >= g_Base_Period_Us) && (g_Base_Period_Us <= Tick_Time_Us))
+    {
+        g_Period_Us      = Tick_Time_Us;
+        g_Next_Expiry_Us = g_Last_Expiry_Us + g_Period_Us;
+        result = E_OK;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+    return result;
+}
+
+/************************************************************************************
+* Service Name: SysTick_GetElapsedTimeUs
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Time in microseconds since the last SysTick interrupt
+* Description: Function to read the host time elapsed in the running SysTick period,
+*              always 0 in the virtual time mode.
+************************************************************************************/
+uint32 SysTick_GetElapsedTimeUs(void)
+{
+    return (uint32)(SysTick_HostNow() - g_Last_Expiry_Us);
+}
+
+/************************************************************************************
+* Service Name: SysTick_HostSetMode
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Mode - SYSTICK_HOST_VIRTUAL_TIME or SYSTICK_HOST_REAL_TIME
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to select the time source of the host SysTick Timer.
+************************************************************************************/
+void SysTick_HostSetMode(uint8 Mode)
+{
+    (void)SysTick_HostNow();
+    g_Host_Mode          = Mode;
+    g_Real_Time_Base_Set = FALSE;
+}
+
+/************************************************************************************
+* Service Name: SysTick_HostSetStopTime
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Stop_Time_Us - Host time in microseconds, 0 to run forever
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to end the simulation: the process exits with EXIT_SUCCESS
+*              instead of delivering the first interrupt after Stop_Time_Us.
+************************************************************************************/
+void SysTick_HostSetStopTime(uint64 Stop_Time_Us)
+{
+    g_Stop_Time_Us = Stop_Time_Us;
+}
+
+/************************************************************************************
+* Service Name: SysTick_HostGetTimeUs
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint64 - Host time in microseconds since the first SysTick_Start
+* Description: Function to read the host time (virtual or real).
+************************************************************************************/
+uint64 SysTick_HostGetTimeUs(void)
+{
+    return SysTick_HostNow();
+}
+
+/************************************************************************************
+* Service Name: SysTick_WaitForInterrupt
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to wait for the next expiry of the host SysTick Timer or Gpt
+*              timers and run its interrupt: the SysTick subscribers or the Gpt timer
+*              interrupt (the SysTick first at the same time). It returns immediately
+*              if all the timers are stopped since nothing else can wake up the host.
+************************************************************************************/
+void SysTick_WaitForInterrupt(void)
+{
+    boolean expiry_found = g_SysTick_Running;
+    uint64 expiry_us = g_Next_Expiry_Us;
+    Gpt_TimerType expiry_timer = GPT_HOST_NO_TIMER;
+    Gpt_TimerType timer;
+
+    /* Earliest expiry of the running timers */
+    for(timer = 0; timer < GPT_TIMERS_NUM; timer++)
+    {
+        if((g_Gpt_Timers[timer].Running == TRUE)
+           && ((expiry_found == FALSE) || (Gpt_HostExpiryUs(&g_Gpt_Timers[timer]) < expiry_us)))
+        {
+            expiry_found = TRUE;
+            expiry_us    = Gpt_HostExpiryUs(&g_Gpt_Timers[timer]);
+            expiry_timer = timer;
+        }
+    }
+
+    if(expiry_found == TRUE)
+    {
+        if((g_Stop_Time_Us != 0U) && (expiry_us > g_Stop_Time_Us))
+        {
+            exit(EXIT_SUCCESS);
+        }
+
+        if(g_Host_Mode == SYSTICK_HOST_REAL_TIME)
+        {
+            (void)SysTick_HostNow();
+            SysTick_HostSleepUntil(expiry_us);
+        }
+        g_Host_Time_Us = expiry_us;
+
+        if(expiry_timer == GPT_HOST_NO_TIMER)
+        {
+            /* The next period starts from this expiry, the subscribers may change it */
+            g_Last_Expiry_Us = g_Next_Expiry_Us;
+            g_Next_Expiry_Us = g_Last_Expiry_Us + g_Period_Us;
+
+            SysTick_Isr((uint16)(g_Period_Us / g_Base_Period_Us));
+        }
+        else
+        {
+            Gpt_TimerIsr(expiry_timer);
+        }
+    }
+}
+
+/************************************************************************************
+* Service Name: Gpt_HwInit
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Channel - Configuration of the channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set up the host timer of a channel, stopped.
+************************************************************************************/
+void Gpt_HwInit(const Gpt_ConfigChannel * Channel)
+{
+    g_Gpt_Timers[Channel->Timer].Running = FALSE;
+    g_Gpt_Timers[Channel->Timer].Mode    = Channel->Mode;
+}
+
+/************************************************************************************
+* Service Name: Gpt_HwDeInit
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Channel - Configuration of the channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop the host timer of a channel.
+************************************************************************************/
+void Gpt_HwDeInit(const Gpt_ConfigChannel * Channel)
+{
+    g_Gpt_Timers[Channel->Timer].Running = FALSE;
+}
+
+/************************************************************************************
+* Service Name: Gpt_HwStart
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Configuration of the channel
+*                  Value   - Target time in number of ticks
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start the host timer of a channel from the current host time.
+************************************************************************************/
+void Gpt_HwStart(const Gpt_ConfigChannel * Channel, Gpt_ValueType Value)
+{
+    g_Gpt_Timers[Channel->Timer].Start_Tick = Gpt_HostNowTicks();
+    g_Gpt_Timers[Channel->Timer].Period     = Value;
+    g_Gpt_Timers[Channel->Timer].Running    = TRUE;
+}
+
+/************************************************************************************
+* Service Name: Gpt_HwStop
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Configuration of the channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop the host timer of a channel, the time elapsed is kept.
+************************************************************************************/
+void Gpt_HwStop(const Gpt_ConfigChannel * Channel)
+{
+    g_Gpt_Timers[Channel->Timer].Running = FALSE;
+}
+
+/************************************************************************************
+* Service Name: Gpt_HwGetElapsed
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Configuration of the channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Gpt_ValueType - Ticks since the start or the last expiry
+* Description: Function to read the host timer of a channel, a timer stopped by
+*              Gpt_HwStop keeps counting here but the Gpt services only read it once
+*              at the stop. In the virtual time mode the time only moves at the expiries.
+************************************************************************************/
+Gpt_ValueType Gpt_HwGetElapsed(const Gpt_ConfigChannel * Channel)
+{
+    const Gpt_HostTimerType * timer = &g_Gpt_Timers[Channel->Timer];
+    uint64 elapsed = Gpt_HostNowTicks() - timer->Start_Tick;
+
+    if(elapsed >= timer->Period)
+    {
+        /* Expiry not delivered yet: a one-shot timer stopped at its period, a continuous one restarted */
+        elapsed = (timer->Mode == GPT_CH_MODE_ONESHOT) ? timer->Period : (elapsed % timer->Period);
+    }
+    return (Gpt_ValueType)elapsed;
+}
+
+/************************************************************************************
+* Service Name: Gpt_HwClearInterrupt
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Configuration of the channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to acknowledge the expiry of the host timer of a channel:
+*              a one-shot timer stops, a continuous timer starts its next period.
+************************************************************************************/
+void Gpt_HwClearInterrupt(const Gpt_ConfigChannel * Channel)
+{
+    Gpt_HostTimerType * timer = &g_Gpt_Timers[Channel->Timer];
+
+    if(timer->Mode == GPT_CH_MODE_ONESHOT)
+    {
+        timer->Running = FALSE;
+    }
+    else
+    {
+        timer->Start_Tick += timer->Period;
+    }
+}
+
+#if (GPT_PREDEF_TIMER_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_HwStartPredefTimer
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start the host predefined timer from the current host time.
+************************************************************************************/
+void Gpt_HwStartPredefTimer(void)
+{
+    g_Predef_Start_Tick = Gpt_HostNowTicks();
+}
+
+/************************************************************************************
+* Service Name: Gpt_HwStopPredefTimer
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop the host predefined timer, nothing to do since the
+*              Gpt services do not read it while the driver is not initialized.
+************************************************************************************/
+void Gpt_HwStopPredefTimer(void)
+{
+}
+
+/************************************************************************************
+* Service Name: Gpt_HwGetPredefTimer
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint64 - Predefined timer value in ticks
+* Description: Function to read the host predefined timer: the host time since the
+*              start, CLOCK_MONOTONIC in the real time mode and the virtual time
+*              otherwise, so it stays in line with the host SysTick.
+************************************************************************************/
+uint64 Gpt_HwGetPredefTimer(void)
+{
+    return Gpt_HostNowTicks() - g_Predef_Start_Tick;
+}
+#endif
+
+#endif /* defined(__linux__) && !defined(GPT_SIM) */
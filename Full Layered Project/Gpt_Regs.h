@@ -0,0 +1,79 @@
+ /******************************************************************************
+ *
+ * Module: Gpt
+ *
+ * File Name: Gpt_Regs.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Gpt Driver Registers
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef GPT_REGS_H
+#define GPT_REGS_H
+
+#include "Std_Types.h"
+
+/* Timer modules base addresses */
+#define GPT_TIMER0_BASE_ADDRESS         0x40030000
+#define GPT_TIMER1_BASE_ADDRESS         0x40031000
+#define GPT_TIMER2_BASE_ADDRESS         0x40032000
+#define GPT_TIMER3_BASE_ADDRESS         0x40033000
+#define GPT_TIMER4_BASE_ADDRESS         0x40034000
+#define GPT_TIMER5_BASE_ADDRESS         0x40035000
+#define GPT_WTIMER0_BASE_ADDRESS        0x40036000
+#define GPT_WTIMER1_BASE_ADDRESS        0x40037000
+#define GPT_WTIMER2_BASE_ADDRESS        0x4004C000
+#define GPT_WTIMER3_BASE_ADDRESS        0x4004D000
+#define GPT_WTIMER4_BASE_ADDRESS        0x4004E000
+#define GPT_WTIMER5_BASE_ADDRESS        0x4004F000
+
+/* Timer registers offset addresses */
+#define GPT_CFG_REG_OFFSET              0x000
+#define GPT_TAMR_REG_OFFSET             0x004
+#define GPT_CTL_REG_OFFSET              0x00C
+#define GPT_IMR_REG_OFFSET              0x018
+#define GPT_RIS_REG_OFFSET              0x01C
+#define GPT_ICR_REG_OFFSET              0x024
+#define GPT_TAILR_REG_OFFSET            0x028
+#define GPT_TBILR_REG_OFFSET            0x02C
+#define GPT_TAR_REG_OFFSET              0x048
+#define GPT_TAV_REG_OFFSET              0x050
+#define GPT_TBV_REG_OFFSET              0x054
+
+/* Configuration register: 32-bit timer of a 16/32-bit timer module, 32-bit timer A of a 32/64-bit wide timer module */
+#define GPT_CFG_32_BIT_TIMER            0x0
+#define GPT_CFG_32_BIT_WIDE_TIMER       0x4
+
+/* Configuration register: 64-bit timer of a 32/64-bit wide timer module (timer A low word, timer B high word) */
+#define GPT_CFG_64_BIT_WIDE_TIMER       0x0
+
+/* Timer A mode register: one-shot or periodic mode, counting down */
+#define GPT_TAMR_ONE_SHOT               0x1
+#define GPT_TAMR_PERIODIC               0x2
+
+/* Timer A mode register: count up */
+#define GPT_TAMR_COUNT_UP_MASK          0x00000010
+
+/* Control register: timer A enable and stall while the debugger halts the core */
+#define GPT_CTL_TAEN_MASK               0x00000001
+#define GPT_CTL_TASTALL_MASK            0x00000002
+
+/* Interrupt registers: timer A time-out bit */
+#define GPT_TATO_MASK                   0x00000001
+
+/* Run mode clock gating and peripheral ready registers of the timer modules (one bit per module) */
+#define SYSCTL_RCGCTIMER_REG            (*((volatile uint32 *)0x400FE604))
+#define SYSCTL_RCGCWTIMER_REG           (*((volatile uint32 *)0x400FE65C))
+#define SYSCTL_PRTIMER_REG              (*((volatile uint32 *)0x400FEA04))
+#define SYSCTL_PRWTIMER_REG             (*((volatile uint32 *)0x400FEA5C))
+
+/* NVIC interrupt set enable, clear enable (one bit per interrupt) and priority (one byte per interrupt) registers */
+#define NVIC_EN_BASE_ADDRESS            0xE000E100
+#define NVIC_DIS_BASE_ADDRESS           0xE000E180
+#define NVIC_PRI_BASE_ADDRESS           0xE000E400
+
+/* Priority bits position in the NVIC priority byte */
+#define NVIC_PRIORITY_BITS_POS          5
+
+#endif /* GPT_REGS_H */
@@ -0,0 +1,376 @@
+ /******************************************************************************
+ *
+ * Module: Mcu
+ *
+ * File Name: Mcu.c
+ *
+ * Description: Source file for TM4C123GH6PM Microcontroller - Mcu Driver.
+ *              The TM4C123 flash needs no wait states or prefetch configuration up to
+ *              the 80Mhz maximum core clock, the flash controller handles them itself.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Mcu.h"
+#include "Mcu_Regs.h"
+
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+
+#include "Det.h"
+/* AUTOSAR Version checking between Det and Mcu Modules */
+#if ((DET_AR_MAJOR_VERSION != MCU_AR_RELEASE_MAJOR_VERSION)\
+ || (DET_AR_MINOR_VERSION != MCU_AR_RELEASE_MINOR_VERSION)\
+ || (DET_AR_PATCH_VERSION != MCU_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Det.h does not match the expected version"
+#endif
+
+#endif
+
+#if (MCU_CORE_CLOCK_HZ > 80000000UL)
+#error "MCU_CORE_CLOCK_HZ is above the TM4C123GH6PM maximum 80Mhz core clock"
+#endif
+
+#if (MCU_XTAL_FREQUENCY != 16000000UL)
+#error "Only the 16Mhz crystal is supported (SYSCTL_RCC_XTAL_16MHZ)"
+#endif
+
+STATIC const Mcu_ConfigType * Mcu_ConfigPtr = NULL_PTR;
+STATIC uint8 Mcu_Status = MCU_NOT_INITIALIZED;
+
+/* Reset cause register latched by Mcu_Init */
+STATIC Mcu_RawResetType Mcu_ResetRawValue = 0U;
+
+/************************************************************************************
+* Service Name: Mcu_Init
+* Service ID[hex]: 0x00
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ConfigPtr - Pointer to post-build configuration data
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to Initialize the Mcu module, the reset cause register is
+*              latched then cleared so the next reset reports only its own cause.
+************************************************************************************/
+void Mcu_Init(const Mcu_ConfigType * ConfigPtr)
+{
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+    /* check if the input configuration pointer is not a NULL_PTR */
+    if (NULL_PTR == ConfigPtr)
+    {
+        Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID, MCU_INIT_SID,
+             MCU_E_PARAM_CONFIG);
+    }
+    else
+#endif
+    {
+#if !defined(__linux__)
+        Mcu_ResetRawValue = SYSCTL_RESC_REG;
+        SYSCTL_RESC_REG = 0U;
+#else
+        /* The host process always starts from a power on */
+        Mcu_ResetRawValue = SYSCTL_RESC_POR_MASK;
+#endif
+        Mcu_Status    = MCU_INITIALIZED;
+        Mcu_ConfigPtr = ConfigPtr; /* address of the Structure */
+    }
+}
+
+/************************************************************************************
+* Service Name: Mcu_InitClock
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ClockSetting - Index of the clock setting in Mcu_PBcfg.c
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK: the clock setting is applied
+*                                E_NOT_OK: invalid clock setting or driver not initialized
+* Description: Function to select the oscillator and the system clock divider of the
+*              clock setting. The core clock runs from the oscillator (bypass) until
+*              Mcu_DistributePllClock is called, a PLL setting starts the PLL locking.
+************************************************************************************/
+Std_ReturnType Mcu_InitClock(Mcu_ClockType ClockSetting)
+{
+    Std_ReturnType result = E_OK;
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the driver is initialized */
+    if(MCU_NOT_INITIALIZED == Mcu_Status)
+    {
+        Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID,
+                        MCU_INIT_CLOCK_SID, MCU_E_UNINIT);
+        result = E_NOT_OK;
+    }
+    /* Check if the clock setting is configured */
+    else if(MCU_CLOCK_SETTINGS_NUM <= ClockSetting)
+    {
+        Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID,
+                        MCU_INIT_CLOCK_SID, MCU_E_PARAM_CLOCK);
+        result = E_NOT_OK;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+#endif
+    if(E_OK == result)
+    {
+#if !defined(__linux__)
+        const Mcu_ClockSettingConfigType * Setting = &Mcu_ConfigPtr->ClockSettings[ClockSetting];
+        uint32 rcc  = SYSCTL_RCC_REG;
+        uint32 rcc2 = SYSCTL_RCC2_REG;
+
+        /* Run from the raw oscillator while the clock tree is changed, RCC2 overrides the RCC fields */
+        rcc2 |= SYSCTL_RCC2_USERCC2_MASK | SYSCTL_RCC2_BYPASS2_MASK;
+        SYSCTL_RCC2_REG = rcc2;
+
+        /* Main oscillator enabled with the crystal value, the divider is used only when the setting divides */
+        rcc &= ~(SYSCTL_RCC_MOSCDIS_MASK | SYSCTL_RCC_XTAL_MASK | SYSCTL_RCC_USESYSDIV_MASK);
+        rcc |= (SYSCTL_RCC_XTAL_16MHZ << SYSCTL_RCC_XTAL_POS);
+        if((TRUE == Setting->Pll_Used) || (0U != Setting->Sysdiv))
+        {
+            rcc |= SYSCTL_RCC_USESYSDIV_MASK;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+        SYSCTL_RCC_REG = rcc;
+
+        rcc2 &= ~(SYSCTL_RCC2_OSCSRC2_MASK | SYSCTL_RCC2_SYSDIV400_MASK | SYSCTL_RCC2_DIV400_MASK);
+        if(MCU_CLOCK_SOURCE_PIOSC == Setting->Source)
+        {
+            rcc2 |= (SYSCTL_RCC2_OSCSRC2_PIOSC << SYSCTL_RCC2_OSCSRC2_POS);
+        }
+        else
+        {
+            rcc2 |= (SYSCTL_RCC2_OSCSRC2_MOSC << SYSCTL_RCC2_OSCSRC2_POS);
+        }
+
+        if(TRUE == Setting->Pll_Used)
+        {
+            /* Power the PLL and divide its 400Mhz output, the lock is polled with Mcu_GetPllStatus */
+            rcc2 &= ~SYSCTL_RCC2_PWRDN2_MASK;
+            rcc2 |= SYSCTL_RCC2_DIV400_MASK | ((uint32)Setting->Sysdiv << SYSCTL_RCC2_SYSDIV400_POS);
+        }
+        else
+        {
+            /* The PLL is not used, the core clock stays on the divided oscillator */
+            rcc2 |= SYSCTL_RCC2_PWRDN2_MASK | ((uint32)Setting->Sysdiv << SYSCTL_RCC2_SYSDIV2_POS);
+        }
+        SYSCTL_RCC2_REG = rcc2;
+#endif
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+    return result;
+}
+
+/************************************************************************************
+* Service Name: Mcu_DistributePllClock
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK: the core clock runs from the PLL
+*                                E_NOT_OK: the PLL is not locked or driver not initialized
+* Description: Function to switch the core clock to the PLL output once it is locked.
+************************************************************************************/
+Std_ReturnType Mcu_DistributePllClock(void)
+{
+    Std_ReturnType result = E_OK;
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the driver is initialized */
+    if(MCU_NOT_INITIALIZED == Mcu_Status)
+    {
+        Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID,
+                        MCU_DISTRIBUTE_PLL_CLOCK_SID, MCU_E_UNINIT);
+        result = E_NOT_OK;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+#endif
+    if(E_OK == result)
+    {
+        if(MCU_PLL_LOCKED != Mcu_GetPllStatus())
+        {
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+            Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID,
+                            MCU_DISTRIBUTE_PLL_CLOCK_SID, MCU_E_PLL_NOT_LOCKED);
+#endif
+            result = E_NOT_OK;
+        }
+        else
+        {
+#if !defined(__linux__)
+            SYSCTL_RCC2_REG &= ~SYSCTL_RCC2_BYPASS2_MASK;
+#endif
+        }
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+    return result;
+}
+
+/************************************************************************************
+* Service Name: Mcu_GetPllStatus
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Mcu_PllStatusType - Lock status of the PLL
+* Description: Function to get the lock status of the PLL.
+************************************************************************************/
+Mcu_PllStatusType Mcu_GetPllStatus(void)
+{
+    Mcu_PllStatusType status = MCU_PLL_STATUS_UNDEFINED;
+    if(MCU_NOT_INITIALIZED == Mcu_Status)
+    {
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID,
+                        MCU_GET_PLL_STATUS_SID, MCU_E_UNINIT);
+#endif
+    }
+    else
+    {
+#if !defined(__linux__)
+        if(SYSCTL_PLLSTAT_REG & SYSCTL_PLLSTAT_LOCK_MASK)
+        {
+            status = MCU_PLL_LOCKED;
+        }
+        else
+        {
+            status = MCU_PLL_UNLOCKED;
+        }
+#else
+        /* The host has no PLL to wait for */
+        status = MCU_PLL_LOCKED;
+#endif
+    }
+    return status;
+}
+
+/************************************************************************************
+* Service Name: Mcu_GetResetReason
+* Service ID[hex]: 0x05
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Mcu_ResetType - Cause of the last reset
+* Description: Function to get the cause of the last reset, when several causes are
+*              latched the power on wins, then the brown out, watchdog, software and RST pin.
+************************************************************************************/
+Mcu_ResetType Mcu_GetResetReason(void)
+{
+    Mcu_ResetType reason = MCU_RESET_UNDEFINED;
+    if(MCU_NOT_INITIALIZED == Mcu_Status)
+    {
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID,
+                        MCU_GET_RESET_REASON_SID, MCU_E_UNINIT);
+#endif
+    }
+    else if(Mcu_ResetRawValue & SYSCTL_RESC_POR_MASK)
+    {
+        reason = MCU_POWER_ON_RESET;
+    }
+    else if(Mcu_ResetRawValue & SYSCTL_RESC_BOR_MASK)
+    {
+        reason = MCU_BROWN_OUT_RESET;
+    }
+    else if(Mcu_ResetRawValue & (SYSCTL_RESC_WDT0_MASK | SYSCTL_RESC_WDT1_MASK))
+    {
+        reason = MCU_WATCHDOG_RESET;
+    }
+    else if(Mcu_ResetRawValue & SYSCTL_RESC_SW_MASK)
+    {
+        reason = MCU_SW_RESET;
+    }
+    else if(Mcu_ResetRawValue & SYSCTL_RESC_EXT_MASK)
+    {
+        reason = MCU_EXTERNAL_RESET;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+    return reason;
+}
+
+/************************************************************************************
+* Service Name: Mcu_GetResetRawValue
+* Service ID[hex]: 0x06
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Mcu_RawResetType - Reset cause register latched by Mcu_Init
+* Description: Function to get the raw reset cause register of the last reset.
+************************************************************************************/
+Mcu_RawResetType Mcu_GetResetRawValue(void)
+{
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+    if(MCU_NOT_INITIALIZED == Mcu_Status)
+    {
+        Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID,
+                        MCU_GET_RESET_RAW_VALUE_SID, MCU_E_UNINIT);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+#endif
+    return Mcu_ResetRawValue;
+}
+
+/************************************************************************************
+* Service Name: Mcu_GetVersionInfo
+* Service ID[hex]: 0x09
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): VersionInfo - Pointer to where to store the version information of this module.
+* Return value: None
+* Description: Function to get the version information of this module.
+************************************************************************************/
+#if (MCU_VERSION_INFO_API == STD_ON)
+void Mcu_GetVersionInfo(Std_VersionInfoType *versioninfo)
+{
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+    /* Check if input pointer is not Null pointer */
+    if(NULL_PTR == versioninfo)
+    {
+        /* Report to DET  */
+        Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID,
+                        MCU_GET_VERSION_INFO_SID, MCU_E_PARAM_POINTER);
+    }
+    else
+#endif /* (MCU_DEV_ERROR_DETECT == STD_ON) */
+    {
+        /* Copy the vendor Id */
+        versioninfo->vendorID = (uint16)MCU_VENDOR_ID;
+        /* Copy the module Id */
+        versioninfo->moduleID = (uint16)MCU_MODULE_ID;
+        /* Copy Software Major Version */
+        versioninfo->sw_major_version = (uint8)MCU_SW_MAJOR_VERSION;
+        /* Copy Software Minor Version */
+        versioninfo->sw_minor_version = (uint8)MCU_SW_MINOR_VERSION;
+        /* Copy Software Patch Version */
+        versioninfo->sw_patch_version = (uint8)MCU_SW_PATCH_VERSION;
+    }
+}
+#endif
@@ -0,0 +1,202 @@
+ /******************************************************************************
+ *
+ * Module: Mcu
+ *
+ * File Name: Mcu.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Mcu Driver.
+ *              The Mcu Driver selects the core clock (main oscillator through the PLL,
+ *              or the precision internal oscillator) and reports the reset reason.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef MCU_H
+#define MCU_H
+
+/* Id for the company in the AUTOSAR
+ * for example Mohamed Tarek's ID = 1000 :) */
+#define MCU_VENDOR_ID    (1000U)
+
+/* Mcu Module Id */
+#define MCU_MODULE_ID    (101U)
+
+/* Mcu Instance Id */
+#define MCU_INSTANCE_ID  (0U)
+
+/*
+ * Module Version 1.0.0
+ */
+#define MCU_SW_MAJOR_VERSION           (1U)
+#define MCU_SW_MINOR_VERSION           (0U)
+#define MCU_SW_PATCH_VERSION           (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define MCU_AR_RELEASE_MAJOR_VERSION   (4U)
+#define MCU_AR_RELEASE_MINOR_VERSION   (0U)
+#define MCU_AR_RELEASE_PATCH_VERSION   (3U)
+
+/*
+ * Macros for Mcu Status
+ */
+#define MCU_INITIALIZED                (1U)
+#define MCU_NOT_INITIALIZED            (0U)
+
+/* Standard AUTOSAR types */
+#include "Std_Types.h"
+
+/* AUTOSAR checking between Std Types and Mcu Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != MCU_AR_RELEASE_MAJOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_MINOR_VERSION != MCU_AR_RELEASE_MINOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_PATCH_VERSION != MCU_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* Mcu Pre-Compile Configuration Header file */
+#include "Mcu_Cfg.h"
+
+/* AUTOSAR Version checking between Mcu_Cfg.h and Mcu.h files */
+#if ((MCU_CFG_AR_RELEASE_MAJOR_VERSION != MCU_AR_RELEASE_MAJOR_VERSION)\
+ ||  (MCU_CFG_AR_RELEASE_MINOR_VERSION != MCU_AR_RELEASE_MINOR_VERSION)\
+ ||  (MCU_CFG_AR_RELEASE_PATCH_VERSION != MCU_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Mcu_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Mcu_Cfg.h and Mcu.h files */
+#if ((MCU_CFG_SW_MAJOR_VERSION != MCU_SW_MAJOR_VERSION)\
+ ||  (MCU_CFG_SW_MINOR_VERSION != MCU_SW_MINOR_VERSION)\
+ ||  (MCU_CFG_SW_PATCH_VERSION != MCU_SW_PATCH_VERSION))
+  #error "The SW version of Mcu_Cfg.h does not match the expected version"
+#endif
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for MCU Init */
+#define MCU_INIT_SID                   (uint8)0x00
+
+/* Service ID for MCU InitClock */
+#define MCU_INIT_CLOCK_SID             (uint8)0x02
+
+/* Service ID for MCU DistributePllClock */
+#define MCU_DISTRIBUTE_PLL_CLOCK_SID   (uint8)0x03
+
+/* Service ID for MCU GetPllStatus */
+#define MCU_GET_PLL_STATUS_SID         (uint8)0x04
+
+/* Service ID for MCU GetResetReason */
+#define MCU_GET_RESET_REASON_SID       (uint8)0x05
+
+/* Service ID for MCU GetResetRawValue */
+#define MCU_GET_RESET_RAW_VALUE_SID    (uint8)0x06
+
+/* Service ID for MCU GetVersionInfo */
+#define MCU_GET_VERSION_INFO_SID       (uint8)0x09
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* Mcu_Init API service called with NULL pointer parameter */
+#define MCU_E_PARAM_CONFIG             (uint8)0x0A
+
+/* Mcu_InitClock called with an invalid clock setting */
+#define MCU_E_PARAM_CLOCK              (uint8)0x0B
+
+/* Mcu_DistributePllClock called before the PLL is locked */
+#define MCU_E_PLL_NOT_LOCKED           (uint8)0x0F
+
+/* API service called without module initialization */
+#define MCU_E_UNINIT                   (uint8)0x10
+
+/* Mcu_GetVersionInfo called with NULL pointer parameter */
+#define MCU_E_PARAM_POINTER            (uint8)0x11
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for Mcu_ClockType ... index of a clock setting */
+typedef uint8 Mcu_ClockType;
+
+/* Type definition for Mcu_RawResetType ... reset cause register (RESC) */
+typedef uint32 Mcu_RawResetType;
+
+/* Type definition for Mcu_PllStatusType */
+typedef enum
+{
+    MCU_PLL_LOCKED,
+    MCU_PLL_UNLOCKED,
+    MCU_PLL_STATUS_UNDEFINED    /* Driver not initialized */
+} Mcu_PllStatusType;
+
+/* Type definition for Mcu_ResetType */
+typedef enum
+{
+    MCU_POWER_ON_RESET,
+    MCU_BROWN_OUT_RESET,
+    MCU_WATCHDOG_RESET,
+    MCU_SW_RESET,
+    MCU_EXTERNAL_RESET,         /* RST pin */
+    MCU_RESET_UNDEFINED
+} Mcu_ResetType;
+
+/* Type definition for the oscillator of a clock setting */
+typedef enum
+{
+    MCU_CLOCK_SOURCE_MOSC,      /* Main oscillator, the MCU_XTAL_FREQUENCY crystal */
+    MCU_CLOCK_SOURCE_PIOSC      /* Precision internal oscillator, 16Mhz */
+} Mcu_ClockSourceType;
+
+typedef struct
+{
+	/* Member contains the oscillator */
+	Mcu_ClockSourceType Source;
+	/* Member contains TRUE if the core clock is the 400Mhz PLL output divided by Sysdiv + 1 */
+	boolean Pll_Used;
+	/* Member contains the PLL divider - 1 (SYSDIV2:SYSDIV2LSB), or the oscillator divider - 1 without PLL */
+	uint8 Sysdiv;
+} Mcu_ClockSettingConfigType;
+
+/* Data Structure required for initializing the Mcu Driver */
+typedef struct Mcu_ConfigType
+{
+	Mcu_ClockSettingConfigType ClockSettings[MCU_CLOCK_SETTINGS_NUM];
+} Mcu_ConfigType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Function for MCU Initialization API, the reset reason is latched */
+void Mcu_Init(const Mcu_ConfigType * ConfigPtr);
+
+/* Function for MCU init clock API ... set up the oscillator and start the PLL, the core clock stays on the oscillator */
+Std_ReturnType Mcu_InitClock(Mcu_ClockType ClockSetting);
+
+/* Function for MCU distribute PLL clock API ... switch the core clock to the locked PLL */
+Std_ReturnType Mcu_DistributePllClock(void);
+
+/* Function for MCU get PLL status API */
+Mcu_PllStatusType Mcu_GetPllStatus(void);
+
+/* Function for MCU get reset reason API */
+Mcu_ResetType Mcu_GetResetReason(void);
+
+/* Function for MCU get reset raw value API ... the RESC register latched by Mcu_Init */
+Mcu_RawResetType Mcu_GetResetRawValue(void);
+
+/* Function for MCU Get Version Info API */
+#if (MCU_VERSION_INFO_API == STD_ON)
+void Mcu_GetVersionInfo(Std_VersionInfoType *versioninfo);
+#endif
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Extern PB structures to be used by Mcu and other modules */
+extern const Mcu_ConfigType Mcu_Configuration;
+
+#endif /* MCU_H */
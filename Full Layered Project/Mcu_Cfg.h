@@ -0,0 +1,72 @@
+ /******************************************************************************
+ *
+ * Module: Mcu
+ *
+ * File Name: Mcu_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - Mcu Driver
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef MCU_CFG_H
+#define MCU_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define MCU_CFG_SW_MAJOR_VERSION              (1U)
+#define MCU_CFG_SW_MINOR_VERSION              (0U)
+#define MCU_CFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define MCU_CFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define MCU_CFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define MCU_CFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* Pre-compile option for Development Error Detect */
+#define MCU_DEV_ERROR_DETECT                (STD_ON)
+
+/* Pre-compile option for Version Info API */
+#define MCU_VERSION_INFO_API                (STD_OFF)
+
+/* Frequency of the crystal on the main oscillator in Hz (16Mhz on the Tiva C LaunchPad) */
+#define MCU_XTAL_FREQUENCY                  (16000000UL)
+
+/* Number of the configured clock settings */
+#define MCU_CLOCK_SETTINGS_NUM              (2U)
+
+/* Clock setting Index in the array of structures in Mcu_PBcfg.c */
+#define McuConf_PLL_80MHZ_CLOCK_SETTING     (Mcu_ClockType)0x00
+#define McuConf_PIOSC_16MHZ_CLOCK_SETTING   (Mcu_ClockType)0x01
+
+/* Core clock of every clock setting in Hz */
+#define McuConf_PLL_80MHZ_FREQUENCY         (80000000UL)
+#define McuConf_PIOSC_16MHZ_FREQUENCY       (16000000UL)
+
+/* TRUE if the core clock of every clock setting runs from the PLL */
+#define McuConf_PLL_80MHZ_USES_PLL          (TRUE)
+#define McuConf_PIOSC_16MHZ_USES_PLL        (FALSE)
+
+/*
+ * Clock setting applied at the start (main.c), by its name: PLL_80MHZ or PIOSC_16MHZ.
+ * All the drivers compute their timer reload values and time conversions from MCU_CORE_CLOCK_HZ.
+ */
+#define MCU_CORE_CLOCK                      PLL_80MHZ
+
+/* Clock setting index and core clock of a clock setting name, the name is expanded first */
+#define MCU_CLOCK_SETTING_INDEX(NAME)       MCU_CLOCK_SETTING_INDEX_NAME(NAME)
+#define MCU_CLOCK_SETTING_INDEX_NAME(NAME)  McuConf_##NAME##_CLOCK_SETTING
+#define MCU_CLOCK_FREQUENCY(NAME)           MCU_CLOCK_FREQUENCY_NAME(NAME)
+#define MCU_CLOCK_FREQUENCY_NAME(NAME)      McuConf_##NAME##_FREQUENCY
+#define MCU_CLOCK_USES_PLL(NAME)            MCU_CLOCK_USES_PLL_NAME(NAME)
+#define MCU_CLOCK_USES_PLL_NAME(NAME)       McuConf_##NAME##_USES_PLL
+
+/* Setting, core clock and PLL use derived from MCU_CORE_CLOCK, they always match */
+#define McuConf_CORE_CLOCK_SETTING          MCU_CLOCK_SETTING_INDEX(MCU_CORE_CLOCK)
+#define MCU_CORE_CLOCK_HZ                   MCU_CLOCK_FREQUENCY(MCU_CORE_CLOCK)
+#define McuConf_CORE_CLOCK_USES_PLL         MCU_CLOCK_USES_PLL(MCU_CORE_CLOCK)
+
+#endif /* MCU_CFG_H */
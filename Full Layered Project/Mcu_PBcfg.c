@@ -0,0 +1,51 @@
+ /******************************************************************************
+ *
+ * Module: Mcu
+ *
+ * File Name: Mcu_PBcfg.c
+ *
+ * Description: Post Build Configuration Source file for TM4C123GH6PM Microcontroller - Mcu Driver
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Mcu.h"
+
+/*
+ * Module Version 1.0.0
+ */
+#define MCU_PBCFG_SW_MAJOR_VERSION              (1U)
+#define MCU_PBCFG_SW_MINOR_VERSION              (0U)
+#define MCU_PBCFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define MCU_PBCFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define MCU_PBCFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define MCU_PBCFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* AUTOSAR Version checking between Mcu_PBcfg.c and Mcu.h files */
+#if ((MCU_PBCFG_AR_RELEASE_MAJOR_VERSION != MCU_AR_RELEASE_MAJOR_VERSION)\
+ ||  (MCU_PBCFG_AR_RELEASE_MINOR_VERSION != MCU_AR_RELEASE_MINOR_VERSION)\
+ ||  (MCU_PBCFG_AR_RELEASE_PATCH_VERSION != MCU_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of PBcfg.c does not match the expected version"
+#endif
+
+/* Software Version checking between Mcu_PBcfg.c and Mcu.h files */
+#if ((MCU_PBCFG_SW_MAJOR_VERSION != MCU_SW_MAJOR_VERSION)\
+ ||  (MCU_PBCFG_SW_MINOR_VERSION != MCU_SW_MINOR_VERSION)\
+ ||  (MCU_PBCFG_SW_PATCH_VERSION != MCU_SW_PATCH_VERSION))
+  #error "The SW version of PBcfg.c does not match the expected version"
+#endif
+
+/* PLL output divided to every core clock */
+#define MCU_PLL_FREQUENCY                       (400000000UL)
+
+/* PB structure used with Mcu_Init API */
+const Mcu_ConfigType Mcu_Configuration = {
+                                             /* McuConf_PLL_80MHZ_CLOCK_SETTING: 400Mhz / 5 */
+                                             MCU_CLOCK_SOURCE_MOSC,McuConf_PLL_80MHZ_USES_PLL,(uint8)((MCU_PLL_FREQUENCY / McuConf_PLL_80MHZ_FREQUENCY) - 1U),
+                                             /* McuConf_PIOSC_16MHZ_CLOCK_SETTING: 16Mhz undivided */
+                                             MCU_CLOCK_SOURCE_PIOSC,McuConf_PIOSC_16MHZ_USES_PLL,0U
+                                         };
@@ -0,0 +1,62 @@
+ /******************************************************************************
+ *
+ * Module: Mcu
+ *
+ * File Name: Mcu_Regs.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Mcu Driver Registers
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef MCU_REGS_H
+#define MCU_REGS_H
+
+#include "Std_Types.h"
+
+/* Reset cause, run-mode clock configuration and PLL status registers */
+#define SYSCTL_RESC_REG                 (*((volatile uint32 *)0x400FE05C))
+#define SYSCTL_RCC_REG                  (*((volatile uint32 *)0x400FE060))
+#define SYSCTL_RCC2_REG                 (*((volatile uint32 *)0x400FE070))
+#define SYSCTL_PLLSTAT_REG              (*((volatile uint32 *)0x400FE168))
+
+/* Reset cause register bits */
+#define SYSCTL_RESC_EXT_MASK            0x00000001
+#define SYSCTL_RESC_POR_MASK            0x00000002
+#define SYSCTL_RESC_BOR_MASK            0x00000004
+#define SYSCTL_RESC_WDT0_MASK           0x00000008
+#define SYSCTL_RESC_SW_MASK             0x00000010
+#define SYSCTL_RESC_WDT1_MASK           0x00000020
+
+/* PLL status register: PLL powered and locked */
+#define SYSCTL_PLLSTAT_LOCK_MASK        0x00000001
+
+/* Run-mode clock configuration register: main oscillator disable, crystal value, bypass and system clock divider use */
+#define SYSCTL_RCC_MOSCDIS_MASK         0x00000001
+#define SYSCTL_RCC_XTAL_MASK            0x000007C0
+#define SYSCTL_RCC_XTAL_POS             6
+#define SYSCTL_RCC_BYPASS_MASK          0x00000800
+#define SYSCTL_RCC_USESYSDIV_MASK       0x00400000
+
+/* Crystal value of the 16Mhz crystal */
+#define SYSCTL_RCC_XTAL_16MHZ           0x15
+
+/* Run-mode clock configuration 2 register: oscillator source, bypass, PLL power down and system clock divider */
+#define SYSCTL_RCC2_OSCSRC2_MASK        0x00000070
+#define SYSCTL_RCC2_OSCSRC2_POS         4
+#define SYSCTL_RCC2_BYPASS2_MASK        0x00000800
+#define SYSCTL_RCC2_PWRDN2_MASK         0x00002000
+#define SYSCTL_RCC2_DIV400_MASK         0x40000000
+#define SYSCTL_RCC2_USERCC2_MASK        0x80000000
+
+/* System clock divider: SYSDIV2 alone (bits 28:23), or SYSDIV2:SYSDIV2LSB (bits 28:22) dividing the 400Mhz PLL output with DIV400 */
+#define SYSCTL_RCC2_SYSDIV2_MASK        0x1F800000
+#define SYSCTL_RCC2_SYSDIV2_POS         23
+#define SYSCTL_RCC2_SYSDIV400_MASK      0x1FC00000
+#define SYSCTL_RCC2_SYSDIV400_POS       22
+
+/* Oscillator sources */
+#define SYSCTL_RCC2_OSCSRC2_MOSC        0x0
+#define SYSCTL_RCC2_OSCSRC2_PIOSC       0x1
+
+#endif /* MCU_REGS_H */
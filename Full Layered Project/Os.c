@@ -10,91 +10,2505 @@
  ******************************************************************************/
 
 #include "Os.h"
+#include "Os_Port.h"
+#include "Os_Trace.h"
 #include "App.h"
-#include "Button.h"
-#include "Led.h"
 #include "Gpt.h"
 
-/* Enable IRQ Interrupts ... This Macro enables IRQ interrupts by clearing the I-bit in the PRIMASK. */
-#define Enable_Interrupts()    __asm("CPSIE I")
+#if (OS_INTERRUPT_LOCK_TRACE == STD_ON)
+#include <string.h>
+#endif
 
-/* Disable IRQ Interrupts ... This Macro disables IRQ interrupts by setting the I-bit in the PRIMASK. */
-#define Disable_Interrupts()   __asm("CPSID I")
+/* Index of the lowest set bit in a non-zero task mask ... CLZ of the bit-reversed mask on ARM */
+#if defined(__ICCARM__)
+#include <intrinsics.h>
+#define Os_FindFirstTask(MASK) ((TaskType)__CLZ(__RBIT(MASK)))
+#else
+#define Os_FindFirstTask(MASK) ((TaskType)__builtin_ctz(MASK))
+#endif
 
-/* Global variable store the Os Time */
-static uint8 g_Time_Tick_Count = 0;
+/* Global variable store the Os Time in ticks since the Os start */
+static volatile TickType g_Time_Tick_Count = 0;
 
-/* Global variable to indicate the the timer has a new tick */
-static uint8 g_New_Time_Tick_Flag = 0;
+/* Number of times g_Time_Tick_Count wrapped around, the high part of the 64-bit Os time */
+static volatile uint32 g_Time_Tick_Wraps = 0;
+
+#if (OS_BASE_TIME_US == 0U) || (OS_BASE_TIME_US > SYSTICK_MAX_START_TIME_US)
+#error "OS_BASE_TIME_US is out of the SysTick_Start range"
+#endif
+
+#if (OS_GPT_TIME == STD_ON)
+#if (GPT_PREDEF_TIMER_API != STD_ON)
+#error "OS_GPT_TIME needs the Gpt predefined timer (GPT_PREDEF_TIMER_API)"
+#endif
+
+/* Gpt predefined timer ticks in one microsecond */
+#define OS_GPT_TICKS_PER_US (GPT_TICK_FREQUENCY / 1000000UL)
+#endif
+
+/* Global variable store the position of the scheduler inside the hyperperiod */
+static TickType g_Frame_Index = 0;
+
+/* Task owning the CPU, OS_IDLE_TASK_ID while the idle loop runs */
+static volatile TaskType g_Running_Task = OS_IDLE_TASK_ID;
+
+/* Number of times every task was still running when its next tick arrived */
+static volatile uint32 g_Task_Overruns[OS_CONFIGURED_TASKS];
+
+/* Events set for every task and not cleared yet */
+static volatile EventMaskType g_Task_Events[OS_CONFIGURED_TASKS];
+
+/* Nesting levels of SuspendAllInterrupts and SuspendOSInterrupts */
+static volatile uint32 g_All_Interrupts_Nesting = 0;
+static volatile uint32 g_Os_Interrupts_Nesting = 0;
+
+/* Interrupt masks restored by the outermost ResumeAllInterrupts and ResumeOSInterrupts */
+static uint32 g_All_Interrupts_Saved_Mask = 0;
+static uint32 g_Os_Interrupts_Saved_Mask = 0;
+
+#if (OS_INTERRUPT_LOCK_TRACE == STD_ON)
+
+/* Call site and start time of a running interrupt lock */
+typedef struct
+{
+    const char * File;
+    uint16 Line;
+    uint32 Start_Time;
+} Os_LockOwnerType;
+
+/* Outermost call sites of the running locks */
+static Os_LockOwnerType g_All_Interrupts_Owner;
+static Os_LockOwnerType g_Os_Interrupts_Owner;
+
+/* Longest lock time of every call site, the used entries are first */
+static Os_LockTraceType g_Lock_Trace[OS_LOCK_TRACE_SITES];
+
+#endif
+
+#if (OS_STACK_MONITOR == STD_ON)
+
+/* Value of every unused stack word */
+#define OS_STACK_PAINT_PATTERN  (0xCDCDCDCDUL)
+
+/* Words left unpainted below the frame of Os_StackInit on the running main stack */
+#define OS_STACK_PAINT_MARGIN   (32U)
+
+/* Fewest unused words found at the bottom of every stack */
+static volatile uint32 g_Stack_Free_Words[OS_STACKS_COUNT];
+
+/* Set of the stacks which wrote their guard zone, bit n represents the stack n */
+static uint32 g_Stack_Overflows = 0;
+
+/* Stack scanned by the next pass of the idle loop */
+static uint8 g_Stack_Scan_Id = 0;
+
+#endif
+
+#if (OS_CPU_LOAD == STD_ON)
+
+/* Idle time of the running CPU load window in timestamp units */
+static volatile uint32 g_Idle_Time = 0;
+
+/* TRUE while the CPU is idle, the idle time runs from g_Idle_Start */
+static volatile boolean g_Idle_Running = FALSE;
+static volatile uint32 g_Idle_Start = 0;
+
+/* Timestamp and Os tick of the start of the running window */
+static uint32 g_Load_Window_Start = 0;
+static TickType g_Load_Window_Tick = 0;
+
+/* Load of the last windows in 0.1 % units, the newest one is at g_Load_Index */
+static uint16 g_Window_Loads[OS_CPU_LOAD_PEAK_WINDOWS];
+static uint8 g_Load_Index = 0;
+
+/* Number of the complete windows, up to OS_CPU_LOAD_PEAK_WINDOWS (the others read 0) */
+static uint8 g_Load_Windows = 0;
+
+#endif
+
+#if (OS_JITTER_HISTOGRAM == STD_ON)
+
+/* Nominal time of the last release of every task in microseconds */
+static uint64 g_Task_Release_Time[OS_CONFIGURED_TASKS];
+
+/* Release jitter histogram of every task */
+static Os_JitterHistogramType g_Task_Jitter[OS_CONFIGURED_TASKS];
+
+#if (OS_GPT_TIME == STD_ON)
+/* Os time of the last tick interrupt in microseconds, the nominal release time of the tasks */
+static uint64 g_Tick_Time_Us = 0;
+#endif
+
+#endif
+
+/*
+ * Hierarchical timer wheel of the alarms: OS_WHEEL_LEVELS levels of OS_WHEEL_SLOTS slots.
+ * Level n holds the alarms expiring in less than OS_WHEEL_SLOTS^(n+1) ticks, an alarm moves
+ * one level down (cascade) every time the wheel passes its slot, so one tick costs O(1)
+ * whatever the number of armed alarms.
+ */
+#define OS_WHEEL_SLOT_BITS      (6U)
+#define OS_WHEEL_SLOTS          (1UL << OS_WHEEL_SLOT_BITS)
+#define OS_WHEEL_SLOT_MASK      (OS_WHEEL_SLOTS - 1U)
+#define OS_WHEEL_LEVELS         (4U)
+
+/* Longest distance covered by the wheel, a farther alarm waits in the last level and is placed again */
+#define OS_WHEEL_MAX_TICKS      ((1UL << (OS_WHEEL_SLOT_BITS * OS_WHEEL_LEVELS)) - 1U)
+
+/* Empty list or alarm not armed */
+#define OS_ALARM_NONE           ((AlarmType)0xFFFF)
+#define OS_WHEEL_NO_SLOT        (0xFFFFU)
+
+/* Runtime state of one alarm, it is linked in the list of its wheel slot while armed */
+typedef struct
+{
+    TickType Expiry;
+    TickType Cycle;
+    AlarmType Next;
+    AlarmType Prev;
+    uint16 Slot;
+} Os_AlarmStateType;
+
+/* Runtime state of every alarm */
+static Os_AlarmStateType g_Alarm_State[OS_CONFIGURED_ALARMS];
+
+/* First alarm in every slot of every level */
+static AlarmType g_Wheel_Head[OS_WHEEL_LEVELS * OS_WHEEL_SLOTS];
+
+/* Counter value reached by the wheel */
+static TickType g_Wheel_Time = 0;
+
+/* Number of the armed alarms */
+static volatile uint32 g_Armed_Alarms = 0;
+
+/* Runtime state of one schedule table */
+typedef struct
+{
+    ScheduleTableStatusType Status;
+    /* Table started at the end of the current round, OS_SCHEDULE_TABLE_NONE if none */
+    ScheduleTableType Next_Table;
+    /* Index of the next expiry point, Expiry_Points_Count for the end of the round */
+    uint8 Point_Index;
+    /* Counter value of the start of the current round */
+    TickType Round_Start;
+    /* Counter value of the next expiry point (or of the end of the round) */
+    TickType Next_Expiry;
+} Os_ScheduleTableStateType;
+
+/* No schedule table follows the running one */
+#define OS_SCHEDULE_TABLE_NONE  ((ScheduleTableType)0xFF)
+
+/* Runtime state of every schedule table */
+static Os_ScheduleTableStateType g_Schedule_Table_State[OS_CONFIGURED_SCHEDULE_TABLES];
+
+/* Set of the running schedule tables, bit n represents the table with index n */
+static volatile uint32 g_Running_Tables = 0;
+
+/* No resource taken */
+#define OS_RESOURCE_NONE        ((ResourceType)0xFF)
+
+/* Runtime state of one resource, the resources taken by a task are linked from the last one */
+typedef struct
+{
+    /* Task holding the resource, OS_IDLE_TASK_ID while it is free */
+    TaskType Owner;
+    /* Priority of the owner before it took the resource */
+    TaskType Previous_Priority;
+    /* Resource taken by the owner before this one, OS_RESOURCE_NONE if none */
+    ResourceType Previous_Resource;
+#if (OS_TASK_STATS == STD_ON)
+    uint32 Start_Time;
+#endif
+} Os_ResourceStateType;
+
+/* Runtime state of every resource */
+static Os_ResourceStateType g_Resource_State[OS_CONFIGURED_RESOURCES];
+
+/* Current priority of every task: its index, raised to the ceiling of the resources it holds */
+static TaskType g_Task_Priority[OS_CONFIGURED_TASKS];
+
+/* Last resource taken by every task, OS_RESOURCE_NONE if it holds none */
+static ResourceType g_Task_Last_Resource[OS_CONFIGURED_TASKS];
+
+/* Set of the tasks holding at least one resource */
+static volatile Os_TaskMaskType g_Resource_Holders = 0;
+
+#if (OS_TICKLESS_IDLE == STD_ON)
+
+/* Longest sleep in Os ticks, limited by the SysTick reload register */
+#define OS_TICKLESS_MAX_TICKS   (SYSTICK_MAX_TICK_TIME_US / OS_BASE_TIME_US)
+
+#if (OS_TICKLESS_MAX_TICKS == 0U)
+#error "OS_TICKLESS_IDLE needs an OS_BASE_TIME_US up to SYSTICK_MAX_TICK_TIME_US"
+#endif
+
+/* Os ticks from each tick of the hyperperiod to the next tick releasing a task */
+static TickType g_Release_Distance[OS_HYPERPERIOD_TICKS];
+
+/* Os ticks covered by the running SysTick period */
+static TickType g_Tick_Step = 1;
+
+/* Tick of the hyperperiod reached by the last SysTick interrupt */
+static TickType g_Wakeup_Frame = 0;
+
+#endif
+
+#if (OS_TASK_STATS == STD_ON)
+
+/* Execution time statistics of every task */
+static Os_TaskStatsType g_Task_Stats[OS_CONFIGURED_TASKS];
+
+/* Sum of the execution times of every task, used to compute the mean */
+static uint64 g_Task_Total_Time[OS_CONFIGURED_TASKS];
+
+/* Hold time statistics of every resource */
+static Os_ResourceStatsType g_Resource_Stats[OS_CONFIGURED_RESOURCES];
+
+#if (OS_PREEMPTIVE == STD_ON)
+/* Execution time accumulated by every task since its start, across preemptions */
+static uint32 g_Task_Exec_Time[OS_CONFIGURED_TASKS];
+
+/* Timestamp of the last context switch */
+static uint32 g_Last_Switch_Time = 0;
+#endif
+
+#endif
+
+#if (OS_PREEMPTIVE == STD_ON)
+
+/* Set of the released tasks which did not finish yet (running, preempted or waiting to start) */
+static volatile Os_TaskMaskType g_Ready_Tasks = 0;
+
+/* Set once the idle context runs, context switches are not requested before */
+static volatile boolean g_Kernel_Started = FALSE;
+
+/* Set of the tasks blocked in WaitEvent, they are neither ready nor terminated */
+static volatile Os_TaskMaskType g_Waiting_Tasks = 0;
+
+/* Events every waiting task is waiting for */
+static EventMaskType g_Task_Wait_Mask[OS_CONFIGURED_TASKS];
+
+#if (OS_OVERRUN_POLICY == OS_OVERRUN_CATCH_UP)
+/* Releases of every task which arrived while the task was still running */
+static uint32 g_Pending_Activations[OS_CONFIGURED_TASKS];
+#endif
+
+#else
+
+/* Global variable store the number of ticks not yet handled by the scheduler */
+static volatile TickType g_Pending_Ticks = 0;
+
+/* Set of the tasks which were running when a tick arrived */
+static volatile Os_TaskMaskType g_Overrun_Tasks = 0;
+
+/* Set of the tasks activated by ActivateTask and not yet dispatched */
+static volatile Os_TaskMaskType g_Activated_Tasks = 0;
+
+#endif
 
 /*********************************************************************************************/
-void Os_start(void)
+/* Description: Move to the next tick of the hyperperiod and return the set of the released tasks */
+static Os_TaskMaskType Os_NextFrame(void)
 {
-    /* Global Interrupts Enable */
-    Enable_Interrupts();
-    
-    /* 
-     * Set the Call Back function to call Os_NewTimerTick
-     * this function will be called every SysTick Interrupt (20ms)
-     */
-    SysTick_SetCallBack(Os_NewTimerTick);
+    g_Frame_Index++;
+    if(g_Frame_Index == OS_HYPERPERIOD_TICKS)
+    {
+	g_Frame_Index = 0;
+    }
 
-    /* Start SysTickTimer to generate interrupt every 20ms */
-    SysTick_Start(OS_BASE_TIME);
+    /* One table lookup gives all the tasks released in this tick */
+    return Os_DispatchTable[g_Frame_Index];
+}
 
-    /* Execute the Init Task */
-    Init_Task();
+#if (OS_TASK_STATS == STD_ON)
+/*********************************************************************************************/
+/* Description: Add one execution time sample to the statistics of a task */
+static void Os_RecordTaskTime(TaskType Task_Id, uint32 Exec_Time)
+{
+    Os_TaskStatsType * stats = &g_Task_Stats[Task_Id];
 
-    /* Start the Os Scheduler */
-    Os_Scheduler();
+    if((stats->Count == 0U) || (Exec_Time < stats->Min_Time))
+    {
+	stats->Min_Time = Exec_Time;
+    }
+    if(Exec_Time > stats->Max_Time)
+    {
+	stats->Max_Time = Exec_Time;
+    }
+    stats->Count++;
+    g_Task_Total_Time[Task_Id] += Exec_Time;
 }
+#endif /* (OS_TASK_STATS == STD_ON) */
 
+#if (OS_CPU_LOAD == STD_ON)
 /*********************************************************************************************/
-void Os_NewTimerTick(void)
+/* Description: Start a new CPU load window now, called with the Os interrupts masked */
+static void Os_CpuLoadStartWindow(uint32 Now)
+{
+    g_Idle_Time         = 0;
+    g_Idle_Start        = Now;
+    g_Load_Window_Start = Now;
+    g_Load_Window_Tick  = g_Time_Tick_Count;
+}
+
+/*********************************************************************************************/
+/* Description: Called by the tick interrupt, store the load of the window once it is complete */
+static void Os_CpuLoadTick(void)
 {
-    /* Increment the Os time by OS_BASE_TIME */
-    g_Time_Tick_Count   += OS_BASE_TIME;
+    uint32 now = Os_Port_GetTimestamp();
+    uint32 window_time;
+
+    if((TickType)(g_Time_Tick_Count - g_Load_Window_Tick) >= OS_CPU_LOAD_WINDOW_TICKS)
+    {
+	/* The idle time running when the tick interrupted the idle loop belongs to this window */
+	if(g_Idle_Running == TRUE)
+	{
+	    g_Idle_Time += (now - g_Idle_Start);
+	}
+	window_time = now - g_Load_Window_Start;
 
-    /* Set the flag to 1 to indicate that there is a new timer tick */
-    g_New_Time_Tick_Flag = 1;
+	g_Load_Index = (uint8)((g_Load_Index + 1U) % OS_CPU_LOAD_PEAK_WINDOWS);
+	g_Window_Loads[g_Load_Index] = (window_time > g_Idle_Time) ?
+	    (uint16)(((uint64)(window_time - g_Idle_Time) * 1000U) / window_time) : 0U;
+	if(g_Load_Windows < OS_CPU_LOAD_PEAK_WINDOWS)
+	{
+	    g_Load_Windows++;
+	}
+	Os_CpuLoadStartWindow(now);
+    }
 }
+#endif /* (OS_CPU_LOAD == STD_ON) */
 
+#if (OS_JITTER_HISTOGRAM == STD_ON)
 /*********************************************************************************************/
-void Os_Scheduler(void)
+/* Description: Return the Os time of the last tick in microseconds, called with the Os interrupts masked */
+static uint64 Os_TickTimeUs(void)
 {
-    while(1)
+#if (OS_GPT_TIME == STD_ON)
+    /* The Gpt time is not aligned on the ticks, the time of the last tick interrupt is kept */
+    return g_Tick_Time_Us;
+#else
+    return ((((uint64)g_Time_Tick_Wraps) << 32) | g_Time_Tick_Count) * OS_BASE_TIME_US;
+#endif
+}
+
+/*********************************************************************************************/
+/* Description: Set the nominal release time of a set of tasks */
+static void Os_JitterRelease(Os_TaskMaskType Tasks, uint64 Release_Time)
+{
+    while(Tasks != 0U)
+    {
+	g_Task_Release_Time[Os_FindFirstTask(Tasks)] = Release_Time;
+	Tasks &= (Tasks - 1U);
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Count the delay from the last release of a task to now in its histogram, called at the task start */
+static void Os_JitterRecord(TaskType Task_Id)
+{
+    Os_JitterHistogramType * histogram = &g_Task_Jitter[Task_Id];
+    uint64 latency = Os_GetTimeUs() - g_Task_Release_Time[Task_Id];
+    uint32 bucket;
+
+    if(latency > 0xFFFFFFFFUL)
+    {
+	latency = 0xFFFFFFFFUL;
+    }
+    bucket = (uint32)latency / OS_JITTER_BUCKET_WIDTH_US;
+    if(bucket >= OS_JITTER_BUCKETS)
+    {
+	bucket = OS_JITTER_BUCKETS - 1U;
+    }
+
+    SuspendOSInterrupts();
+    histogram->Buckets[bucket]++;
+    histogram->Count++;
+    if((uint32)latency > histogram->Max_Latency)
+    {
+	histogram->Max_Latency = (uint32)latency;
+    }
+    ResumeOSInterrupts();
+}
+#endif /* (OS_JITTER_HISTOGRAM == STD_ON) */
+
+/*********************************************************************************************/
+/* Description: Link an alarm in the wheel slot matching its distance to the expiry */
+static void Os_WheelInsert(AlarmType Alarm_Id)
+{
+    Os_AlarmStateType * alarm = &g_Alarm_State[Alarm_Id];
+    TickType distance = alarm->Expiry - g_Wheel_Time;
+    TickType position = alarm->Expiry;
+    uint8 level = 0;
+    uint16 slot;
+
+    if(distance > OS_WHEEL_MAX_TICKS)
+    {
+	/* Wait in the slot passed last, the alarm is placed again when the wheel reaches it */
+	distance = OS_WHEEL_MAX_TICKS;
+	position = g_Wheel_Time + OS_WHEEL_MAX_TICKS;
+    }
+    while((level < (OS_WHEEL_LEVELS - 1U)) && (distance >= (1UL << (OS_WHEEL_SLOT_BITS * (level + 1U)))))
+    {
+	level++;
+    }
+
+    slot = (uint16)((level * OS_WHEEL_SLOTS) + ((position >> (OS_WHEEL_SLOT_BITS * level)) & OS_WHEEL_SLOT_MASK));
+    alarm->Slot = slot;
+    alarm->Prev = OS_ALARM_NONE;
+    alarm->Next = g_Wheel_Head[slot];
+    if(alarm->Next != OS_ALARM_NONE)
+    {
+	g_Alarm_State[alarm->Next].Prev = Alarm_Id;
+    }
+    g_Wheel_Head[slot] = Alarm_Id;
+}
+
+/*********************************************************************************************/
+/* Description: Unlink an alarm from its wheel slot */
+static void Os_WheelRemove(AlarmType Alarm_Id)
+{
+    Os_AlarmStateType * alarm = &g_Alarm_State[Alarm_Id];
+
+    if(alarm->Prev != OS_ALARM_NONE)
+    {
+	g_Alarm_State[alarm->Prev].Next = alarm->Next;
+    }
+    else
+    {
+	g_Wheel_Head[alarm->Slot] = alarm->Next;
+    }
+    if(alarm->Next != OS_ALARM_NONE)
+    {
+	g_Alarm_State[alarm->Next].Prev = alarm->Prev;
+    }
+    alarm->Slot = OS_WHEEL_NO_SLOT;
+}
+
+/*********************************************************************************************/
+/* Description: Take all the alarms of one slot and place them again according to their new distance */
+static void Os_WheelCascade(uint16 Slot)
+{
+    AlarmType alarm_id = g_Wheel_Head[Slot];
+    AlarmType next_id;
+
+    g_Wheel_Head[Slot] = OS_ALARM_NONE;
+    while(alarm_id != OS_ALARM_NONE)
+    {
+	next_id = g_Alarm_State[alarm_id].Next;
+	Os_WheelInsert(alarm_id);
+	alarm_id = next_id;
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Advance the alarm wheel by one tick and do the action of every expired alarm */
+static void Os_AlarmTick(void)
+{
+    AlarmType alarm_id;
+    AlarmType next_id;
+    uint8 level = 1;
+    uint32 index;
+
+    g_Wheel_Time++;
+
+    /* Every OS_WHEEL_SLOTS ticks the next slot of the upper level moves down, the same for the upper levels */
+    if((g_Wheel_Time & OS_WHEEL_SLOT_MASK) == 0U)
+    {
+	do
+	{
+	    index = (g_Wheel_Time >> (OS_WHEEL_SLOT_BITS * level)) & OS_WHEEL_SLOT_MASK;
+	    Os_WheelCascade((uint16)((level * OS_WHEEL_SLOTS) + index));
+	    level++;
+	} while((index == 0U) && (level < OS_WHEEL_LEVELS));
+    }
+
+    /* All the alarms in the current slot of the first level expire now */
+    alarm_id = g_Wheel_Head[g_Wheel_Time & OS_WHEEL_SLOT_MASK];
+    g_Wheel_Head[g_Wheel_Time & OS_WHEEL_SLOT_MASK] = OS_ALARM_NONE;
+    while(alarm_id != OS_ALARM_NONE)
+    {
+	next_id = g_Alarm_State[alarm_id].Next;
+
+	if(g_Alarm_State[alarm_id].Expiry != g_Wheel_Time)
+	{
+	    /* Armed for the current tick value of a later counter revolution */
+	    Os_WheelInsert(alarm_id);
+	}
+	else
+	{
+	    /* Re-arm a cyclic alarm before its action, the action may cancel it */
+	    if(g_Alarm_State[alarm_id].Cycle != 0U)
+	    {
+		g_Alarm_State[alarm_id].Expiry += g_Alarm_State[alarm_id].Cycle;
+		Os_WheelInsert(alarm_id);
+	    }
+	    else
+	    {
+		g_Alarm_State[alarm_id].Slot = OS_WHEEL_NO_SLOT;
+		g_Armed_Alarms--;
+	    }
+
+	    switch(Os_AlarmConfiguration[alarm_id].Action)
+	    {
+		case OS_ALARM_ACTIVATETASK: (void)ActivateTask(Os_AlarmConfiguration[alarm_id].Task_Id);
+					    break;
+		case OS_ALARM_SETEVENT:     (void)SetEvent(Os_AlarmConfiguration[alarm_id].Task_Id, Os_AlarmConfiguration[alarm_id].Event);
+					    break;
+		case OS_ALARM_CALLBACK:     Os_AlarmConfiguration[alarm_id].Callback_Ptr();
+					    break;
+		default:                    break;
+	    }
+	}
+	alarm_id = next_id;
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Arm an alarm to expire at the given counter value */
+static StatusType Os_ArmAlarm(AlarmType Alarm_Id, TickType Expiry, TickType Cycle)
+{
+    StatusType result = E_OK;
+
+    SuspendOSInterrupts();
+    if(g_Alarm_State[Alarm_Id].Slot != OS_WHEEL_NO_SLOT)
+    {
+	result = E_OS_STATE;
+    }
+    else
+    {
+	g_Alarm_State[Alarm_Id].Expiry = Expiry;
+	g_Alarm_State[Alarm_Id].Cycle  = Cycle;
+	Os_WheelInsert(Alarm_Id);
+	g_Armed_Alarms++;
+    }
+    ResumeOSInterrupts();
+
+    return result;
+}
+
+/*********************************************************************************************/
+/* Description: Start with an empty wheel, all the alarms disarmed and all the schedule tables stopped */
+static void Os_AlarmInit(void)
+{
+    uint16 index;
+
+    for(index = 0; index < (OS_WHEEL_LEVELS * OS_WHEEL_SLOTS); index++)
     {
-	/* Code is only executed in case there is a new timer tick */
-	if(g_New_Time_Tick_Flag == 1)
-	{
-	    switch(g_Time_Tick_Count)
-            {
-		case 20:
-		case 100:
-			    Button_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 40:
-		case 80:
-			    Button_Task();
-			    Led_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 60:
-			    Button_Task();
-			    App_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 120:
-			    Button_Task();
-			    App_Task();
-			    Led_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    g_Time_Tick_Count = 0;
-			    break;
-            }
+	g_Wheel_Head[index] = OS_ALARM_NONE;
+    }
+    for(index = 0; index < OS_CONFIGURED_ALARMS; index++)
+    {
+	g_Alarm_State[index].Slot = OS_WHEEL_NO_SLOT;
+    }
+    g_Wheel_Time   = g_Time_Tick_Count;
+    g_Armed_Alarms = 0;
+
+    for(index = 0; index < OS_CONFIGURED_SCHEDULE_TABLES; index++)
+    {
+	g_Schedule_Table_State[index].Status     = SCHEDULETABLE_STOPPED;
+	g_Schedule_Table_State[index].Next_Table = OS_SCHEDULE_TABLE_NONE;
+    }
+    g_Running_Tables = 0;
+}
+
+/*********************************************************************************************/
+/* Description: Start a new round of a schedule table at the given counter value */
+static void Os_ScheduleTableStartRound(ScheduleTableType Table_Id, TickType Round_Start)
+{
+    Os_ScheduleTableStateType * table = &g_Schedule_Table_State[Table_Id];
+
+    table->Status      = SCHEDULETABLE_RUNNING;
+    table->Round_Start = Round_Start;
+    table->Point_Index = 0;
+    table->Next_Expiry = Round_Start + Os_ScheduleTableConfiguration[Table_Id].Expiry_Points[0].Offset;
+    g_Running_Tables  |= (1UL << Table_Id);
+}
+
+/*********************************************************************************************/
+/* Description: Process the expiry points of a running schedule table reached by the counter */
+static void Os_ScheduleTableProcess(ScheduleTableType Table_Id)
+{
+    Os_ScheduleTableStateType * table = &g_Schedule_Table_State[Table_Id];
+    const Os_ScheduleTableConfigType * config = &Os_ScheduleTableConfiguration[Table_Id];
+    Os_TaskMaskType activated_tasks;
+    ScheduleTableType next_table;
+
+    while((table->Status == SCHEDULETABLE_RUNNING) && (table->Next_Expiry == g_Wheel_Time))
+    {
+	if(table->Point_Index < config->Expiry_Points_Count)
+	{
+	    /* Expiry point: activate its tasks then wait for the next point or the end of the round */
+	    activated_tasks = config->Expiry_Points[table->Point_Index].Activated_Tasks;
+	    while(activated_tasks != 0U)
+	    {
+		(void)ActivateTask(Os_FindFirstTask(activated_tasks));
+		activated_tasks &= (activated_tasks - 1U);
+	    }
+
+	    table->Point_Index++;
+	    if(table->Point_Index < config->Expiry_Points_Count)
+	    {
+		table->Next_Expiry = table->Round_Start + config->Expiry_Points[table->Point_Index].Offset;
+	    }
+	    else
+	    {
+		table->Next_Expiry = table->Round_Start + config->Duration;
+	    }
+	}
+	else
+	{
+	    /* End of the round: the next table takes over at the frame boundary, otherwise repeat or stop */
+	    next_table = table->Next_Table;
+	    table->Next_Table = OS_SCHEDULE_TABLE_NONE;
+	    if((next_table != OS_SCHEDULE_TABLE_NONE) && (g_Schedule_Table_State[next_table].Status == SCHEDULETABLE_NEXT))
+	    {
+		table->Status     = SCHEDULETABLE_STOPPED;
+		g_Running_Tables &= ~(1UL << Table_Id);
+		Os_ScheduleTableStartRound(next_table, g_Wheel_Time);
+	    }
+	    else if(config->Repeating == TRUE)
+	    {
+		Os_ScheduleTableStartRound(Table_Id, g_Wheel_Time);
+	    }
+	    else
+	    {
+		table->Status     = SCHEDULETABLE_STOPPED;
+		g_Running_Tables &= ~(1UL << Table_Id);
+	    }
 	}
     }
+}
+
+/*********************************************************************************************/
+/* Description: Process all the running schedule tables after the counter advanced by one tick */
+static void Os_ScheduleTableTick(void)
+{
+    uint32 processed_tables = 0;
+    uint32 running_tables = g_Running_Tables;
+    ScheduleTableType table_id;
+
+    /* A table started by NextScheduleTable in this tick is processed in the same tick */
+    while(running_tables != 0U)
+    {
+	table_id = (ScheduleTableType)Os_FindFirstTask(running_tables);
+	processed_tables |= (1UL << table_id);
+	Os_ScheduleTableProcess(table_id);
+	running_tables = g_Running_Tables & ~processed_tables;
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Start a stopped schedule table with its first round at the given counter value */
+static StatusType Os_StartScheduleTable(ScheduleTableType Table_Id, TickType Start)
+{
+    StatusType result = E_OK;
+
+    SuspendOSInterrupts();
+    if(g_Schedule_Table_State[Table_Id].Status != SCHEDULETABLE_STOPPED)
+    {
+	result = E_OS_STATE;
+    }
+    else
+    {
+	g_Schedule_Table_State[Table_Id].Next_Table = OS_SCHEDULE_TABLE_NONE;
+	Os_ScheduleTableStartRound(Table_Id, Start);
+    }
+    ResumeOSInterrupts();
+
+    return result;
+}
+
+/*********************************************************************************************/
+/* Description: Start with all the resources free and every task at its own priority */
+static void Os_ResourceInit(void)
+{
+    uint8 index;
+
+    for(index = 0; index < OS_CONFIGURED_RESOURCES; index++)
+    {
+	g_Resource_State[index].Owner = OS_IDLE_TASK_ID;
+    }
+    for(index = 0; index < OS_CONFIGURED_TASKS; index++)
+    {
+	g_Task_Priority[index]      = (TaskType)index;
+	g_Task_Last_Resource[index] = OS_RESOURCE_NONE;
+    }
+    g_Resource_Holders = 0;
+}
+
+/*********************************************************************************************/
+/* Description: Called with the Os interrupts masked, give a resource back and restore the priority of its owner */
+static void Os_FreeResource(ResourceType Res_Id)
+{
+    Os_ResourceStateType * resource = &g_Resource_State[Res_Id];
+    TaskType task_id = resource->Owner;
+
+#if (OS_TASK_STATS == STD_ON)
+    uint32 hold_time = Os_Port_GetTimestamp() - resource->Start_Time;
+
+    g_Resource_Stats[Res_Id].Count++;
+    if(hold_time > g_Resource_Stats[Res_Id].Max_Hold_Time)
+    {
+	g_Resource_Stats[Res_Id].Max_Hold_Time = hold_time;
+    }
+#endif
+
+    g_Task_Priority[task_id]      = resource->Previous_Priority;
+    g_Task_Last_Resource[task_id] = resource->Previous_Resource;
+    resource->Owner = OS_IDLE_TASK_ID;
+    if(resource->Previous_Resource == OS_RESOURCE_NONE)
+    {
+	g_Resource_Holders &= ~OS_TASK_MASK(task_id);
+    }
+
+    if(Os_ResourceConfiguration[Res_Id].Isr_Users == TRUE)
+    {
+	/* End the Os interrupts lock started by GetResource */
+	ResumeOSInterrupts();
+    }
 
+#if (OS_PREEMPTIVE == STD_ON)
+    /* A task kept out by the ceiling may run now */
+    if((g_Kernel_Started == TRUE) && (g_Ready_Tasks != 0U) && (Os_FindFirstTask(g_Ready_Tasks) < task_id))
+    {
+	Os_Port_RequestSwitch();
+    }
+#endif
 }
+
 /*********************************************************************************************/
+/* Description: Called with the Os interrupts masked at the end of a task, release the resources it did not release */
+static void Os_ReleaseTaskResources(TaskType Task_Id)
+{
+    while(g_Task_Last_Resource[Task_Id] != OS_RESOURCE_NONE)
+    {
+	Os_FreeResource(g_Task_Last_Resource[Task_Id]);
+    }
+}
+
+#if (OS_STACK_MONITOR == STD_ON)
+/*********************************************************************************************/
+/* Description: Paint the unused words of every stack, the main stack is painted up to the frame of this function */
+static void Os_StackInit(void)
+{
+    uint32 frame_marker = 0;
+    uint32 * bottom;
+    uint32 words;
+    uint32 painted_words;
+    uint32 index;
+    uint8 stack_id;
+
+    for(stack_id = 0; stack_id < OS_STACKS_COUNT; stack_id++)
+    {
+	painted_words = 0;
+	if(Os_Port_GetStackArea(stack_id, &bottom, &words) == TRUE)
+	{
+	    painted_words = words;
+	    if((&frame_marker >= bottom) && (&frame_marker < &bottom[words]))
+	    {
+		/* Running on this stack ... keep the words used by the callers and this function */
+		painted_words = (uint32)(&frame_marker - bottom);
+		painted_words = (painted_words > OS_STACK_PAINT_MARGIN) ? (painted_words - OS_STACK_PAINT_MARGIN) : 0U;
+	    }
+	    for(index = 0; index < painted_words; index++)
+	    {
+		bottom[index] = OS_STACK_PAINT_PATTERN;
+	    }
+	}
+	g_Stack_Free_Words[stack_id] = painted_words;
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Count the painted words left at the bottom of a stack to update its high-water mark */
+static void Os_StackScan(uint8 Stack_Id)
+{
+    uint32 * bottom;
+    uint32 words;
+    uint32 free_words = 0;
+
+    if(Os_Port_GetStackArea(Stack_Id, &bottom, &words) == TRUE)
+    {
+	/* The stack only grows ... the words above the last result are already used */
+	while((free_words < g_Stack_Free_Words[Stack_Id]) && (bottom[free_words] == OS_STACK_PAINT_PATTERN))
+	{
+	    free_words++;
+	}
+
+	SuspendOSInterrupts();
+	if(free_words < g_Stack_Free_Words[Stack_Id])
+	{
+	    g_Stack_Free_Words[Stack_Id] = free_words;
+	}
+	ResumeOSInterrupts();
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Called by the tick interrupt, check the guard zone of every stack and report a new overflow */
+static void Os_StackCheckGuards(void)
+{
+    uint32 * bottom;
+    uint32 words;
+    uint32 index;
+    uint8 stack_id;
+
+    for(stack_id = 0; stack_id < OS_STACKS_COUNT; stack_id++)
+    {
+	if(((g_Stack_Overflows & (1UL << stack_id)) == 0U) && (Os_Port_GetStackArea(stack_id, &bottom, &words) == TRUE))
+	{
+	    index = 0;
+	    while((index < OS_STACK_GUARD_WORDS) && (bottom[index] == OS_STACK_PAINT_PATTERN))
+	    {
+		index++;
+	    }
+	    if(index < OS_STACK_GUARD_WORDS)
+	    {
+		g_Stack_Overflows |= (1UL << stack_id);
+		Os_StackOverflowHook(stack_id);
+	    }
+	}
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Called by the idle loop, scan one stack per pass so the idle loop stays short */
+static void Os_StackMonitorIdle(void)
+{
+    Os_StackScan(g_Stack_Scan_Id);
+    g_Stack_Scan_Id = (g_Stack_Scan_Id + 1U < OS_STACKS_COUNT) ? (g_Stack_Scan_Id + 1U) : 0U;
+}
+#endif /* (OS_STACK_MONITOR == STD_ON) */
+
+#if (OS_TICKLESS_IDLE == STD_ON)
+/*********************************************************************************************/
+/* Description: Compute the distance from every tick of the hyperperiod to the next task release */
+static void Os_TicklessInit(void)
+{
+    TickType frame;
+    TickType distance;
+
+    for(frame = 0; frame < OS_HYPERPERIOD_TICKS; frame++)
+    {
+	distance = 1;
+	while((distance < OS_TICKLESS_MAX_TICKS) && (distance < OS_HYPERPERIOD_TICKS)
+	      && (Os_DispatchTable[(frame + distance) % OS_HYPERPERIOD_TICKS] == 0U))
+	{
+	    distance++;
+	}
+	g_Release_Distance[frame] = distance;
+    }
+}
+
+/*********************************************************************************************/
+/*
+ * Description: Called in the SysTick interrupt, return the Os ticks elapsed since the last interrupt
+ *              and program the next interrupt at the next task release. The new period starts
+ *              from the last expiry, so the Os time does not drift.
+ */
+static TickType Os_TicklessAdvance(void)
+{
+    TickType elapsed_ticks = g_Tick_Step;
+    TickType next_step;
+
+    g_Wakeup_Frame += elapsed_ticks;
+    if(g_Wakeup_Frame >= OS_HYPERPERIOD_TICKS)
+    {
+	g_Wakeup_Frame -= OS_HYPERPERIOD_TICKS;
+    }
+
+    next_step = g_Release_Distance[g_Wakeup_Frame];
+
+    /* The alarm wheel needs every tick while an alarm is armed or a schedule table runs */
+    if((g_Armed_Alarms != 0U) || (g_Running_Tables != 0U))
+    {
+	next_step = 1;
+    }
+
+    if(next_step != g_Tick_Step)
+    {
+	g_Tick_Step = next_step;
+	(void)SysTick_ChangePeriod((uint32)(g_Tick_Step * OS_BASE_TIME_US));
+    }
+
+    return elapsed_ticks;
+}
+#endif /* (OS_TICKLESS_IDLE == STD_ON) */
+
+/*********************************************************************************************/
+void Os_start(void)
+{
+#if (OS_PREEMPTIVE == STD_ON)
+    /* Context switch interrupt must be configured before the first task is released */
+    Os_Port_Init();
+#endif
+
+#if (OS_STACK_MONITOR == STD_ON)
+    /* Paint the stacks before any task context is prepared */
+    Os_StackInit();
+#endif
+
+#if (OS_TICKLESS_IDLE == STD_ON)
+    Os_TicklessInit();
+#endif
+
+    Os_AlarmInit();
+
+    Os_ResourceInit();
+
+#if (OS_TASK_STATS == STD_ON) || (OS_INTERRUPT_LOCK_TRACE == STD_ON) || (OS_TRACE == STD_ON) || (OS_CPU_LOAD == STD_ON) || (SYSTICK_ISR_STATS == STD_ON)
+    /* Start the timestamp counter used to measure the tasks, the interrupt locks, the idle time and the SysTick interrupt and to trace the events */
+    Os_Port_InitTimestamp();
+#endif
+
+#if (OS_TASK_STATS == STD_ON)
+    Os_ResetTaskStats();
+#endif
+
+    /* Global Interrupts Enable */
+    Enable_Interrupts();
+
+    /*
+     * Subscribe Os_NewTimerTick to the SysTick
+     * this function will be called every SysTick Interrupt (OS_BASE_TIME_US)
+     */
+    (void)SysTick_Subscribe(Os_NewTimerTick, 1U);
+
+    /* Start SysTickTimer to generate interrupt every OS_BASE_TIME_US, the range is checked at compile time */
+    (void)SysTick_Start(OS_BASE_TIME_US);
+
+    /* Execute the Init Task */
+    Init_Task();
+
+#if (OS_PREEMPTIVE == STD_ON)
+    /* Run the Os Scheduler as the idle context on its own stack */
+    Os_Port_StartScheduler();
+#else
+    /* Start the Os Scheduler */
+    Os_Scheduler();
+#endif
+}
+
+/*********************************************************************************************/
+void Os_NewTimerTick(void)
+{
+    TickType elapsed_ticks;
+#if (OS_PREEMPTIVE == STD_ON)
+    Os_TaskMaskType released_tasks = 0;
+    Os_TaskMaskType restarted_tasks;
+    Os_TaskMaskType overrun_tasks;
+    TaskType task_id;
+#endif
+
+#if (OS_STACK_MONITOR == STD_ON)
+    Os_StackCheckGuards();
+#endif
+
+#if (OS_TICKLESS_IDLE == STD_ON)
+    elapsed_ticks = Os_TicklessAdvance();
+#else
+    elapsed_ticks = 1;
+#endif
+
+    /* Increment the Os time by the elapsed ticks (OS_BASE_TIME_US each) */
+    g_Time_Tick_Count += elapsed_ticks;
+    if(g_Time_Tick_Count < elapsed_ticks)
+    {
+	g_Time_Tick_Wraps++;
+    }
+#if ((OS_JITTER_HISTOGRAM == STD_ON) && (OS_GPT_TIME == STD_ON))
+    g_Tick_Time_Us = Os_GetTimeUs();
+#endif
+
+    /* Expire the alarms and schedule table expiry points tick by tick, the counter jumps directly while none is used */
+    if((g_Armed_Alarms == 0U) && (g_Running_Tables == 0U))
+    {
+	g_Wheel_Time = g_Time_Tick_Count;
+    }
+    while(g_Wheel_Time != g_Time_Tick_Count)
+    {
+	Os_AlarmTick();
+	Os_ScheduleTableTick();
+    }
+
+#if (OS_CPU_LOAD == STD_ON)
+    Os_CpuLoadTick();
+#endif
+
+#if (OS_PREEMPTIVE == STD_ON)
+    /* Ticks skipped by the tickless mode release no task, only the last one may */
+    while(elapsed_ticks > 0U)
+    {
+	released_tasks |= Os_NextFrame();
+	elapsed_ticks--;
+    }
+
+    /* A released task which did not finish its previous release (ready or waiting for an event) overran its period */
+    overrun_tasks = released_tasks & (g_Ready_Tasks | g_Waiting_Tasks);
+    while(overrun_tasks != 0U)
+    {
+	task_id = Os_FindFirstTask(overrun_tasks);
+	overrun_tasks &= (overrun_tasks - 1U);
+	g_Task_Overruns[task_id]++;
+#if (OS_OVERRUN_POLICY == OS_OVERRUN_CATCH_UP)
+	/* Run the task again as soon as its current execution ends */
+	g_Pending_Activations[task_id]++;
+#elif (OS_OVERRUN_POLICY == OS_OVERRUN_HOOK)
+	Os_OverrunHook(task_id);
+#endif
+    }
+
+    /* A task still running from its previous release keeps its context, the others restart from the entry point */
+    restarted_tasks = released_tasks & ~(g_Ready_Tasks | g_Waiting_Tasks);
+#if (OS_JITTER_HISTOGRAM == STD_ON)
+    Os_JitterRelease(restarted_tasks, Os_TickTimeUs());
+#endif
+    while(restarted_tasks != 0U)
+    {
+	task_id = Os_FindFirstTask(restarted_tasks);
+	restarted_tasks &= (restarted_tasks - 1U);
+	Os_Port_InitContext(task_id);
+#if (OS_TASK_STATS == STD_ON)
+	g_Task_Exec_Time[task_id] = 0;
+#endif
+    }
+    g_Ready_Tasks |= (released_tasks & ~g_Waiting_Tasks);
+
+    /* Preempt the running task if a higher priority task is released */
+    if((g_Kernel_Started == TRUE) && (released_tasks != 0U) && (Os_FindFirstTask(g_Ready_Tasks) < g_Running_Task))
+    {
+	Os_Port_RequestSwitch();
+    }
+#else
+    /* Count the new ticks, the scheduler handles them according to OS_OVERRUN_POLICY */
+    g_Pending_Ticks += elapsed_ticks;
+
+    /* A task still running when the tick arrives overran its time slot */
+    if(g_Running_Task != OS_IDLE_TASK_ID)
+    {
+	g_Task_Overruns[g_Running_Task]++;
+	g_Overrun_Tasks |= ((Os_TaskMaskType)1U << g_Running_Task);
+    }
+#endif
+}
+
+#if (OS_PREEMPTIVE == STD_ON)
+
+/************************************************************************************
+* Service Name: Os_ScheduleNext
+* Description: Called by the port inside the context switch with interrupts disabled,
+*              select the highest priority ready task or the idle context.
+************************************************************************************/
+TaskType Os_ScheduleNext(void)
+{
+#if (OS_TASK_STATS == STD_ON)
+    uint32 now = Os_Port_GetTimestamp();
+
+    /* Charge the time since the last switch to the task leaving the CPU */
+    if(g_Running_Task != OS_IDLE_TASK_ID)
+    {
+	g_Task_Exec_Time[g_Running_Task] += (now - g_Last_Switch_Time);
+    }
+    g_Last_Switch_Time = now;
+#endif
+
+    Os_TaskMaskType holders = g_Ready_Tasks & g_Resource_Holders;
+    TaskType task_id;
+#if (OS_CPU_LOAD == STD_ON)
+    uint32 idle_now = Os_Port_GetTimestamp();
+
+    /* The idle context leaves the CPU ... or keeps it, the idle time restarts from now */
+    if(g_Idle_Running == TRUE)
+    {
+	g_Idle_Time += (idle_now - g_Idle_Start);
+    }
+#endif
+
+    if(g_Ready_Tasks != 0U)
+    {
+	g_Running_Task = Os_FindFirstTask(g_Ready_Tasks);
+
+	/* A task holding a resource runs at the ceiling priority, it keeps the CPU against the tasks up to that priority */
+	while(holders != 0U)
+	{
+	    task_id  = Os_FindFirstTask(holders);
+	    holders &= (holders - 1U);
+	    if(g_Task_Priority[task_id] <= g_Task_Priority[g_Running_Task])
+	    {
+		g_Running_Task = task_id;
+	    }
+	}
+    }
+    else
+    {
+	g_Running_Task = OS_IDLE_TASK_ID;
+    }
+#if (OS_CPU_LOAD == STD_ON)
+    g_Idle_Running = (g_Running_Task == OS_IDLE_TASK_ID) ? TRUE : FALSE;
+    g_Idle_Start   = idle_now;
+#endif
+    return g_Running_Task;
+}
+
+/************************************************************************************
+* Service Name: Os_RunTask
+* Description: Entry of every task context, executes the task then terminates it.
+*              The context is prepared again by the next release of the task.
+************************************************************************************/
+void Os_RunTask(TaskType Task_Id)
+{
+    boolean activated = TRUE;
+#if (OS_TASK_STATS == STD_ON)
+    uint32 now;
+#endif
+
+#if (OS_JITTER_HISTOGRAM == STD_ON)
+    /* Only the first execution follows the release of the context, the catch-up executions are not counted */
+    Os_JitterRecord(Task_Id);
+#endif
+
+    while(activated == TRUE)
+    {
+	OS_TRACE_EVENT(OS_TRACE_TASK_BEGIN, Task_Id, 0U);
+	Os_TaskConfiguration[Task_Id].Task_Ptr();
+	OS_TRACE_EVENT(OS_TRACE_TASK_END, Task_Id, 0U);
+
+	SuspendOSInterrupts();
+
+	/* A task shall release its resources before it ends, release the ones it forgot */
+	Os_ReleaseTaskResources(Task_Id);
+
+#if (OS_TASK_STATS == STD_ON)
+	now = Os_Port_GetTimestamp();
+	Os_RecordTaskTime(Task_Id, g_Task_Exec_Time[Task_Id] + (now - g_Last_Switch_Time));
+	g_Task_Exec_Time[Task_Id] = 0;
+	g_Last_Switch_Time = now;
+#endif
+#if (OS_OVERRUN_POLICY == OS_OVERRUN_CATCH_UP)
+	/* Releases which arrived during the execution run back to back in the same context */
+	if(g_Pending_Activations[Task_Id] != 0U)
+	{
+	    g_Pending_Activations[Task_Id]--;
+	    ResumeOSInterrupts();
+	}
+	else
+#endif
+	{
+	    /* Terminate with the interrupts still disabled */
+	    activated = FALSE;
+	}
+    }
+
+    g_Ready_Tasks &= ~((Os_TaskMaskType)1U << Task_Id);
+    Os_Port_RequestSwitch();
+    ResumeOSInterrupts();
+
+    /* The pending context switch leaves this context forever */
+    while(1)
+    {
+    }
+}
+
+#else
+
+/*********************************************************************************************/
+/* Description: Run the released tasks to completion in the order of their index */
+static void Os_DispatchTasks(Os_TaskMaskType Ready_Tasks)
+{
+    TaskType task_id;
+#if (OS_TASK_STATS == STD_ON)
+    uint32 start_time;
+#endif
+
+    while(Ready_Tasks != 0U)
+    {
+	task_id = Os_FindFirstTask(Ready_Tasks);
+	Ready_Tasks &= (Ready_Tasks - 1U);
+
+	g_Running_Task = task_id;
+#if (OS_JITTER_HISTOGRAM == STD_ON)
+	Os_JitterRecord(task_id);
+#endif
+	OS_TRACE_EVENT(OS_TRACE_TASK_BEGIN, task_id, 0U);
+#if (OS_TASK_STATS == STD_ON)
+	start_time = Os_Port_GetTimestamp();
+	Os_TaskConfiguration[task_id].Task_Ptr();
+	Os_RecordTaskTime(task_id, Os_Port_GetTimestamp() - start_time);
+#else
+	Os_TaskConfiguration[task_id].Task_Ptr();
+#endif
+	OS_TRACE_EVENT(OS_TRACE_TASK_END, task_id, 0U);
+
+	/* A task shall release its resources before it ends, release the ones it forgot */
+	if((g_Resource_Holders & OS_TASK_MASK(task_id)) != 0U)
+	{
+	    SuspendOSInterrupts();
+	    Os_ReleaseTaskResources(task_id);
+	    ResumeOSInterrupts();
+	}
+    }
+    g_Running_Task = OS_IDLE_TASK_ID;
+}
+
+#endif /* (OS_PREEMPTIVE == STD_ON) */
+
+/*********************************************************************************************/
+void Os_Scheduler(void)
+{
+#if (OS_PREEMPTIVE == STD_ON)
+    /* Idle context: tasks are released by the tick and preempt this loop */
+    g_Kernel_Started = TRUE;
+
+#if (OS_CPU_LOAD == STD_ON)
+    /* The first window starts with the scheduler, the Init Task is not measured */
+    SuspendOSInterrupts();
+    Os_CpuLoadStartWindow(Os_Port_GetTimestamp());
+    g_Idle_Running = TRUE;
+    ResumeOSInterrupts();
+#endif
+
+    /* Dispatch the tasks released before the kernel started */
+    Os_Port_RequestSwitch();
+
+    while(1)
+    {
+#if (OS_STACK_MONITOR == STD_ON)
+	Os_StackMonitorIdle();
+#endif
+	Os_Port_Idle();
+    }
+#else
+    TickType pending_ticks;
+    Os_TaskMaskType ready_tasks;
+    Os_TaskMaskType frame_tasks;
+#if (OS_JITTER_HISTOGRAM == STD_ON)
+    uint64 tick_time;
+#endif
+#if (OS_OVERRUN_POLICY == OS_OVERRUN_HOOK)
+    Os_TaskMaskType overrun_tasks;
+#endif
+
+#if (OS_CPU_LOAD == STD_ON)
+    /* The first window starts with the scheduler, the Init Task is not measured */
+    SuspendOSInterrupts();
+    Os_CpuLoadStartWindow(Os_Port_GetTimestamp());
+    ResumeOSInterrupts();
+#endif
+
+    while(1)
+    {
+	/* Code is only executed in case there is a new timer tick or an activated task */
+	if((g_Pending_Ticks != 0U) || (g_Activated_Tasks != 0U))
+	{
+	    /* Take all the ticks elapsed since the last dispatch (several in tickless mode or after an overrun) */
+	    SuspendOSInterrupts();
+	    pending_ticks     = g_Pending_Ticks;
+	    g_Pending_Ticks   = 0;
+	    ready_tasks       = g_Activated_Tasks;
+	    g_Activated_Tasks = 0;
+#if (OS_OVERRUN_POLICY == OS_OVERRUN_HOOK)
+	    overrun_tasks     = g_Overrun_Tasks;
+#endif
+	    g_Overrun_Tasks   = 0;
+#if (OS_JITTER_HISTOGRAM == STD_ON)
+	    tick_time         = Os_TickTimeUs();
+#endif
+	    ResumeOSInterrupts();
+
+#if (OS_OVERRUN_POLICY == OS_OVERRUN_HOOK)
+	    while(overrun_tasks != 0U)
+	    {
+		Os_OverrunHook(Os_FindFirstTask(overrun_tasks));
+		overrun_tasks &= (overrun_tasks - 1U);
+	    }
+#endif
+
+	    while(pending_ticks != 0U)
+	    {
+		pending_ticks--;
+		frame_tasks = Os_NextFrame();
+#if (OS_JITTER_HISTOGRAM == STD_ON)
+		/* Nominal release of the tasks of this tick, the pending ticks left came after it */
+		Os_JitterRelease(frame_tasks, tick_time - ((uint64)pending_ticks * OS_BASE_TIME_US));
+#endif
+		if(pending_ticks == 0U)
+		{
+		    /* The tasks of the last tick run together with the activated tasks in priority order */
+		    ready_tasks |= frame_tasks;
+		}
+		else
+		{
+#if (OS_OVERRUN_POLICY == OS_OVERRUN_CATCH_UP)
+		    /* Run the tasks of every missed tick back to back */
+		    Os_DispatchTasks(frame_tasks);
+#else
+		    /* Only the last tick is dispatched, the releases of the missed ticks are dropped */
+#endif
+		}
+	    }
+
+	    Os_DispatchTasks(ready_tasks);
+	}
+	else
+	{
+#if (OS_STACK_MONITOR == STD_ON)
+	    Os_StackMonitorIdle();
+#endif
+	    /* Sleep until the next interrupt, the check and the sleep are atomic so no tick is missed */
+	    Disable_Interrupts();
+	    if((g_Pending_Ticks == 0U) && (g_Activated_Tasks == 0U))
+	    {
+#if (OS_CPU_LOAD == STD_ON)
+		/* The wake up is timestamped before the interrupt runs, the interrupts are counted as load */
+		g_Idle_Start   = Os_Port_GetTimestamp();
+		g_Idle_Running = TRUE;
+		Os_Port_WaitForInterrupt();
+		g_Idle_Running = FALSE;
+		g_Idle_Time   += (Os_Port_GetTimestamp() - g_Idle_Start);
+#else
+		Os_Port_WaitForInterrupt();
+#endif
+	    }
+	    Enable_Interrupts();
+	}
+    }
+#endif
+}
+/*********************************************************************************************/
+
+#if (OS_TASK_STATS == STD_ON)
+/************************************************************************************
+* Service Name: Os_GetTaskStats
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Task_Id - Index of the task in the Os task table
+* Parameters (inout): None
+* Parameters (out): Stats - Execution time statistics of the task
+* Return value: Std_ReturnType - E_OK or E_NOT_OK for an invalid parameter
+* Description: Function to get the execution time statistics of a task.
+************************************************************************************/
+Std_ReturnType Os_GetTaskStats(TaskType Task_Id, Os_TaskStatsType * Stats)
+{
+    Std_ReturnType result = E_NOT_OK;
+    uint64 total_time;
+
+    if((Task_Id < OS_CONFIGURED_TASKS) && (Stats != NULL_PTR))
+    {
+	/* Take a consistent copy, the statistics may be updated from the context switch */
+	SuspendOSInterrupts();
+	*Stats     = g_Task_Stats[Task_Id];
+	total_time = g_Task_Total_Time[Task_Id];
+	ResumeOSInterrupts();
+
+	Stats->Mean_Time = (Stats->Count != 0U) ? (uint32)(total_time / Stats->Count) : 0U;
+	result = E_OK;
+    }
+    return result;
+}
+
+/************************************************************************************
+* Service Name: Os_ResetTaskStats
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to clear the execution time statistics of all the tasks and
+*              the hold time statistics of all the resources.
+************************************************************************************/
+void Os_ResetTaskStats(void)
+{
+    TaskType task_id;
+    ResourceType index;
+
+    SuspendOSInterrupts();
+    for(task_id = 0; task_id < OS_CONFIGURED_TASKS; task_id++)
+    {
+	g_Task_Stats[task_id].Count     = 0;
+	g_Task_Stats[task_id].Min_Time  = 0;
+	g_Task_Stats[task_id].Max_Time  = 0;
+	g_Task_Stats[task_id].Mean_Time = 0;
+	g_Task_Total_Time[task_id]      = 0;
+    }
+    for(index = 0; index < OS_CONFIGURED_RESOURCES; index++)
+    {
+	g_Resource_Stats[index].Count         = 0;
+	g_Resource_Stats[index].Max_Hold_Time = 0;
+    }
+    ResumeOSInterrupts();
+}
+
+/************************************************************************************
+* Service Name: Os_GetResourceStats
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ResID - Index of the resource in the Os resource table
+* Parameters (inout): None
+* Parameters (out): Stats - Hold time statistics of the resource
+* Return value: Std_ReturnType - E_OK or E_NOT_OK for an invalid parameter
+* Description: Function to get the hold time statistics of a resource.
+************************************************************************************/
+Std_ReturnType Os_GetResourceStats(ResourceType ResID, Os_ResourceStatsType * Stats)
+{
+    Std_ReturnType result = E_NOT_OK;
+
+    if((ResID < OS_CONFIGURED_RESOURCES) && (Stats != NULL_PTR))
+    {
+	SuspendOSInterrupts();
+	*Stats = g_Resource_Stats[ResID];
+	ResumeOSInterrupts();
+	result = E_OK;
+    }
+    return result;
+}
+#endif /* (OS_TASK_STATS == STD_ON) */
+
+#if (OS_INTERRUPT_LOCK_TRACE == STD_ON)
+/*********************************************************************************************/
+/* Description: Record the time of an interrupt lock ending now in the entry of its call site */
+static void Os_RecordLockTime(const Os_LockOwnerType * Owner)
+{
+    uint32 lock_time = Os_Port_GetTimestamp() - Owner->Start_Time;
+    uint8 index = 0;
+
+    /* Find the entry of the call site or the first unused entry */
+    while((index < OS_LOCK_TRACE_SITES) && (g_Lock_Trace[index].File != NULL_PTR) &&
+          ((g_Lock_Trace[index].Line != Owner->Line) || (strcmp(g_Lock_Trace[index].File, Owner->File) != 0)))
+    {
+	index++;
+    }
+
+    /* A call site found when all the entries are used is not recorded */
+    if(index < OS_LOCK_TRACE_SITES)
+    {
+	g_Lock_Trace[index].File = Owner->File;
+	g_Lock_Trace[index].Line = Owner->Line;
+	g_Lock_Trace[index].Count++;
+	if(lock_time > g_Lock_Trace[index].Max_Time)
+	{
+	    g_Lock_Trace[index].Max_Time = lock_time;
+	}
+    }
+}
+#endif
+
+/************************************************************************************
+* Service Name: SuspendAllInterrupts
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): File - Source file of the call (lock tracing only)
+*                  Line - Source line of the call (lock tracing only)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to mask all the interrupts. The outermost call saves the
+*              interrupt mask, the nested calls only count the nesting level.
+************************************************************************************/
+#if (OS_INTERRUPT_LOCK_TRACE == STD_ON)
+void Os_SuspendAllInterruptsSite(const char * File, uint16 Line)
+#else
+void SuspendAllInterrupts(void)
+#endif
+{
+    uint32 mask = Os_Port_GetAllInterruptsMask();
+
+    Os_Port_SetAllInterruptsMask(1U);
+    if(g_All_Interrupts_Nesting == 0U)
+    {
+	g_All_Interrupts_Saved_Mask = mask;
+#if (OS_INTERRUPT_LOCK_TRACE == STD_ON)
+	g_All_Interrupts_Owner.File       = File;
+	g_All_Interrupts_Owner.Line       = Line;
+	g_All_Interrupts_Owner.Start_Time = Os_Port_GetTimestamp();
+#endif
+    }
+    g_All_Interrupts_Nesting++;
+}
+
+/************************************************************************************
+* Service Name: ResumeAllInterrupts
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to leave a SuspendAllInterrupts critical section, the call
+*              matching the outermost SuspendAllInterrupts restores the interrupt mask.
+*              A call without a matching SuspendAllInterrupts is ignored.
+************************************************************************************/
+void ResumeAllInterrupts(void)
+{
+    if(g_All_Interrupts_Nesting != 0U)
+    {
+	g_All_Interrupts_Nesting--;
+	if(g_All_Interrupts_Nesting == 0U)
+	{
+#if (OS_INTERRUPT_LOCK_TRACE == STD_ON)
+	    Os_RecordLockTime(&g_All_Interrupts_Owner);
+#endif
+	    Os_Port_SetAllInterruptsMask(g_All_Interrupts_Saved_Mask);
+	}
+    }
+}
+
+/************************************************************************************
+* Service Name: SuspendOSInterrupts
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): File - Source file of the call (lock tracing only)
+*                  Line - Source line of the call (lock tracing only)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to mask the interrupts calling the Os services and the context
+*              switch, the interrupts with a priority above OS_ISR_PRIORITY_LIMIT keep
+*              running. The outermost call saves the mask, the nested calls only count
+*              the nesting level.
+************************************************************************************/
+#if (OS_INTERRUPT_LOCK_TRACE == STD_ON)
+void Os_SuspendOSInterruptsSite(const char * File, uint16 Line)
+#else
+void SuspendOSInterrupts(void)
+#endif
+{
+    uint32 mask = Os_Port_GetOsInterruptsMask();
+
+    Os_Port_SetOsInterruptsMask(OS_PORT_OS_INTERRUPTS_MASK);
+    if(g_Os_Interrupts_Nesting == 0U)
+    {
+	g_Os_Interrupts_Saved_Mask = mask;
+#if (OS_INTERRUPT_LOCK_TRACE == STD_ON)
+	g_Os_Interrupts_Owner.File       = File;
+	g_Os_Interrupts_Owner.Line       = Line;
+	g_Os_Interrupts_Owner.Start_Time = Os_Port_GetTimestamp();
+#endif
+    }
+    g_Os_Interrupts_Nesting++;
+}
+
+/************************************************************************************
+* Service Name: ResumeOSInterrupts
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to leave a SuspendOSInterrupts critical section, the call
+*              matching the outermost SuspendOSInterrupts restores the mask and a
+*              context switch requested inside the section is taken.
+*              A call without a matching SuspendOSInterrupts is ignored.
+************************************************************************************/
+void ResumeOSInterrupts(void)
+{
+    if(g_Os_Interrupts_Nesting != 0U)
+    {
+	g_Os_Interrupts_Nesting--;
+	if(g_Os_Interrupts_Nesting == 0U)
+	{
+#if (OS_INTERRUPT_LOCK_TRACE == STD_ON)
+	    Os_RecordLockTime(&g_Os_Interrupts_Owner);
+#endif
+	    Os_Port_SetOsInterruptsMask(g_Os_Interrupts_Saved_Mask);
+	}
+    }
+}
+
+#if (OS_INTERRUPT_LOCK_TRACE == STD_ON)
+/************************************************************************************
+* Service Name: Os_GetLockTrace
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Index - Entry of the interrupt lock trace
+* Parameters (inout): None
+* Parameters (out): Trace - Call site, count and longest lock time of the entry
+* Return value: Std_ReturnType - E_OK or E_NOT_OK for an unused entry or a NULL pointer
+* Description: Function to read one entry of the interrupt lock trace.
+************************************************************************************/
+Std_ReturnType Os_GetLockTrace(uint8 Index, Os_LockTraceType * Trace)
+{
+    Std_ReturnType result = E_NOT_OK;
+
+    if((Index < OS_LOCK_TRACE_SITES) && (Trace != NULL_PTR))
+    {
+	/* Take a consistent copy, the entry may be updated from an interrupt */
+	SuspendAllInterrupts();
+	*Trace = g_Lock_Trace[Index];
+	ResumeAllInterrupts();
+
+	if(Trace->File != NULL_PTR)
+	{
+	    result = E_OK;
+	}
+    }
+    return result;
+}
+
+/************************************************************************************
+* Service Name: Os_ResetLockTrace
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to clear the interrupt lock trace.
+************************************************************************************/
+void Os_ResetLockTrace(void)
+{
+    uint8 index;
+
+    SuspendAllInterrupts();
+    for(index = 0; index < OS_LOCK_TRACE_SITES; index++)
+    {
+	g_Lock_Trace[index].File     = NULL_PTR;
+	g_Lock_Trace[index].Line     = 0;
+	g_Lock_Trace[index].Count    = 0;
+	g_Lock_Trace[index].Max_Time = 0;
+    }
+    ResumeAllInterrupts();
+}
+#endif /* (OS_INTERRUPT_LOCK_TRACE == STD_ON) */
+
+#if (OS_CPU_LOAD == STD_ON)
+/************************************************************************************
+* Service Name: Os_GetCpuLoad
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Load - Load of the last window and peak load of the last windows
+* Return value: Std_ReturnType - E_OK or E_NOT_OK for a NULL pointer or if no window
+*                                is complete yet
+* Description: Function to get the CPU load measured from the idle time.
+************************************************************************************/
+Std_ReturnType Os_GetCpuLoad(Os_CpuLoadType * Load)
+{
+    Std_ReturnType result = E_NOT_OK;
+    uint8 index;
+
+    if(Load != NULL_PTR)
+    {
+	SuspendOSInterrupts();
+	if(g_Load_Windows != 0U)
+	{
+	    Load->Load      = g_Window_Loads[g_Load_Index];
+	    Load->Peak_Load = 0;
+	    for(index = 0; index < OS_CPU_LOAD_PEAK_WINDOWS; index++)
+	    {
+		if(g_Window_Loads[index] > Load->Peak_Load)
+		{
+		    Load->Peak_Load = g_Window_Loads[index];
+		}
+	    }
+	    result = E_OK;
+	}
+	ResumeOSInterrupts();
+    }
+    return result;
+}
+#endif /* (OS_CPU_LOAD == STD_ON) */
+
+#if (OS_JITTER_HISTOGRAM == STD_ON)
+/************************************************************************************
+* Service Name: Os_GetJitterHistogram
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Task_Id - Index of the task in the Os task table
+* Parameters (inout): None
+* Parameters (out): Histogram - Release jitter histogram of the task
+* Return value: Std_ReturnType - E_OK or E_NOT_OK for an invalid parameter
+* Description: Function to get the histogram of the delays from the nominal releases
+*              of a task to its starts.
+************************************************************************************/
+Std_ReturnType Os_GetJitterHistogram(TaskType Task_Id, Os_JitterHistogramType * Histogram)
+{
+    Std_ReturnType result = E_NOT_OK;
+
+    if((Task_Id < OS_CONFIGURED_TASKS) && (Histogram != NULL_PTR))
+    {
+	/* Take a consistent copy, the histogram may be updated by a preempting task */
+	SuspendOSInterrupts();
+	*Histogram = g_Task_Jitter[Task_Id];
+	ResumeOSInterrupts();
+	result = E_OK;
+    }
+    return result;
+}
+
+/************************************************************************************
+* Service Name: Os_ResetJitterHistograms
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to clear the release jitter histograms of all the tasks.
+************************************************************************************/
+void Os_ResetJitterHistograms(void)
+{
+    TaskType task_id;
+    uint8 bucket;
+
+    SuspendOSInterrupts();
+    for(task_id = 0; task_id < OS_CONFIGURED_TASKS; task_id++)
+    {
+	g_Task_Jitter[task_id].Count       = 0;
+	g_Task_Jitter[task_id].Max_Latency = 0;
+	for(bucket = 0; bucket < OS_JITTER_BUCKETS; bucket++)
+	{
+	    g_Task_Jitter[task_id].Buckets[bucket] = 0;
+	}
+    }
+    ResumeOSInterrupts();
+}
+#endif /* (OS_JITTER_HISTOGRAM == STD_ON) */
+
+#if (OS_STACK_MONITOR == STD_ON)
+/************************************************************************************
+* Service Name: Os_GetStackUsage
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Stack_Id - Task index, OS_IDLE_TASK_ID or OS_MAIN_STACK_ID
+* Parameters (inout): None
+* Parameters (out): Usage - Size and high-water mark of the stack in bytes
+* Return value: Std_ReturnType - E_OK or E_NOT_OK for an unused stack or a NULL pointer
+* Description: Function to scan a stack then read its size and deepest use since the
+*              Os start.
+************************************************************************************/
+Std_ReturnType Os_GetStackUsage(uint8 Stack_Id, Os_StackUsageType * Usage)
+{
+    Std_ReturnType result = E_NOT_OK;
+    uint32 * bottom;
+    uint32 words;
+
+    if((Stack_Id < OS_STACKS_COUNT) && (Usage != NULL_PTR) && (Os_Port_GetStackArea(Stack_Id, &bottom, &words) == TRUE))
+    {
+	Os_StackScan(Stack_Id);
+	Usage->Size     = words * 4U;
+	Usage->Max_Used = (words - g_Stack_Free_Words[Stack_Id]) * 4U;
+	result = E_OK;
+    }
+    return result;
+}
+#endif /* (OS_STACK_MONITOR == STD_ON) */
+
+/************************************************************************************
+* Service Name: ActivateTask
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): TaskID - Index of the task in the Os task table
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: StatusType - E_OK, E_OS_ID for an invalid task or E_OS_LIMIT if the
+*                            task is already activated and did not end yet
+* Description: Function to activate a task from a task or an ISR. In the preemptive
+*              kernel the task preempts the caller if it has a higher priority,
+*              otherwise it runs in the next pass of the scheduler.
+************************************************************************************/
+StatusType ActivateTask(TaskType TaskID)
+{
+    StatusType result = E_OS_ID;
+    Os_TaskMaskType task_mask;
+
+    if(TaskID < OS_CONFIGURED_TASKS)
+    {
+	task_mask = ((Os_TaskMaskType)1U << TaskID);
+	result    = E_OK;
+
+	SuspendOSInterrupts();
+#if (OS_PREEMPTIVE == STD_ON)
+	if(((g_Ready_Tasks | g_Waiting_Tasks) & task_mask) != 0U)
+	{
+	    result = E_OS_LIMIT;
+	}
+	else
+	{
+	    Os_Port_InitContext(TaskID);
+#if (OS_TASK_STATS == STD_ON)
+	    g_Task_Exec_Time[TaskID] = 0;
+#endif
+#if (OS_JITTER_HISTOGRAM == STD_ON)
+	    g_Task_Release_Time[TaskID] = Os_GetTimeUs();
+#endif
+	    g_Ready_Tasks |= task_mask;
+	    if((g_Kernel_Started == TRUE) && (TaskID < g_Running_Task))
+	    {
+		Os_Port_RequestSwitch();
+	    }
+	}
+#else
+	if((g_Activated_Tasks & task_mask) != 0U)
+	{
+	    result = E_OS_LIMIT;
+	}
+	else
+	{
+#if (OS_JITTER_HISTOGRAM == STD_ON)
+	    g_Task_Release_Time[TaskID] = Os_GetTimeUs();
+#endif
+	    g_Activated_Tasks |= task_mask;
+	}
+#endif
+	ResumeOSInterrupts();
+    }
+    return result;
+}
+
+/************************************************************************************
+* Service Name: GetTaskID
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): TaskID - Index of the running task, OS_IDLE_TASK_ID if none
+* Return value: StatusType - E_OK or E_OS_VALUE for a NULL pointer
+* Description: Function to get the task calling the service (or the task interrupted
+*              by the calling ISR).
+************************************************************************************/
+StatusType GetTaskID(TaskRefType TaskID)
+{
+    StatusType result = E_OS_VALUE;
+
+    if(TaskID != NULL_PTR)
+    {
+	*TaskID = g_Running_Task;
+	result  = E_OK;
+    }
+    return result;
+}
+
+/************************************************************************************
+* Service Name: SetEvent
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): TaskID - Index of the task in the Os task table
+*                  Mask   - Events to set
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: StatusType - E_OK or E_OS_ID for an invalid task
+* Description: Function to set events of a task from a task or an ISR. A task waiting
+*              for one of the events becomes ready again and preempts the caller if
+*              it has a higher priority.
+************************************************************************************/
+StatusType SetEvent(TaskType TaskID, EventMaskType Mask)
+{
+    StatusType result = E_OS_ID;
+
+    if(TaskID < OS_CONFIGURED_TASKS)
+    {
+	SuspendOSInterrupts();
+	g_Task_Events[TaskID] |= Mask;
+#if (OS_PREEMPTIVE == STD_ON)
+	if(((g_Waiting_Tasks & ((Os_TaskMaskType)1U << TaskID)) != 0U) && ((g_Task_Events[TaskID] & g_Task_Wait_Mask[TaskID]) != 0U))
+	{
+	    /* Resume the task from WaitEvent */
+	    g_Waiting_Tasks &= ~((Os_TaskMaskType)1U << TaskID);
+	    g_Ready_Tasks   |= ((Os_TaskMaskType)1U << TaskID);
+	    if((g_Kernel_Started == TRUE) && (TaskID < g_Running_Task))
+	    {
+		Os_Port_RequestSwitch();
+	    }
+	}
+#endif
+	ResumeOSInterrupts();
+	result = E_OK;
+    }
+    return result;
+}
+
+/************************************************************************************
+* Service Name: ClearEvent
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Mask - Events to clear
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: StatusType - E_OK or E_OS_CALLEVEL if no task is running
+* Description: Function to clear events of the calling task.
+************************************************************************************/
+StatusType ClearEvent(EventMaskType Mask)
+{
+    StatusType result = E_OS_CALLEVEL;
+    TaskType task_id = g_Running_Task;
+
+    if(task_id != OS_IDLE_TASK_ID)
+    {
+	SuspendOSInterrupts();
+	g_Task_Events[task_id] &= ~Mask;
+	ResumeOSInterrupts();
+	result = E_OK;
+    }
+    return result;
+}
+
+/************************************************************************************
+* Service Name: GetEvent
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): TaskID - Index of the task in the Os task table
+* Parameters (inout): None
+* Parameters (out): Event - Current events of the task
+* Return value: StatusType - E_OK or E_OS_ID for an invalid task or a NULL pointer
+* Description: Function to read the events of a task.
+************************************************************************************/
+StatusType GetEvent(TaskType TaskID, EventMaskRefType Event)
+{
+    StatusType result = E_OS_ID;
+
+    if((TaskID < OS_CONFIGURED_TASKS) && (Event != NULL_PTR))
+    {
+	*Event = g_Task_Events[TaskID];
+	result = E_OK;
+    }
+    return result;
+}
+
+/************************************************************************************
+* Service Name: WaitEvent
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Mask - Events to wait for
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: StatusType - E_OK once one of the events is set, E_OS_CALLEVEL if no
+*                            task is running, E_OS_RESOURCE if the task holds a
+*                            resource, E_OS_ACCESS if the task masks the interrupts
+*                            (SuspendOSInterrupts or SuspendAllInterrupts) or, in the
+*                            cooperative scheduler, if none of the events is set
+* Description: Function to block the calling task until one of the events is set.
+*              The events are not cleared, the task shall call ClearEvent.
+************************************************************************************/
+StatusType WaitEvent(EventMaskType Mask)
+{
+    StatusType result = E_OS_CALLEVEL;
+    TaskType task_id = g_Running_Task;
+
+    if(task_id != OS_IDLE_TASK_ID)
+    {
+	result = E_OK;
+
+	SuspendOSInterrupts();
+	if((g_Resource_Holders & OS_TASK_MASK(task_id)) != 0U)
+	{
+	    /* A task holding a resource shall not block, the other users would wait for it */
+	    result = E_OS_RESOURCE;
+	}
+	else if((g_Os_Interrupts_Nesting > 1U) || (g_All_Interrupts_Nesting != 0U))
+	{
+	    /* The caller masks the interrupts itself: the switch would wait for its Resume and the task would not block */
+	    result = E_OS_ACCESS;
+	}
+	else if((g_Task_Events[task_id] & Mask) == 0U)
+	{
+#if (OS_PREEMPTIVE == STD_ON)
+	    /* Leave the ready set, the switch is taken once the interrupts are enabled again */
+	    g_Task_Wait_Mask[task_id] = Mask;
+	    g_Waiting_Tasks |= ((Os_TaskMaskType)1U << task_id);
+	    g_Ready_Tasks   &= ~((Os_TaskMaskType)1U << task_id);
+	    Os_Port_RequestSwitch();
+#else
+	    /* All the tasks share the scheduler stack, a task cannot block */
+	    result = E_OS_ACCESS;
+#endif
+	}
+	ResumeOSInterrupts();
+    }
+    return result;
+}
+
+/************************************************************************************
+* Service Name: GetResource
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ResID - Index of the resource in the Os resource table
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: StatusType - E_OK, E_OS_ID for an invalid resource, E_OS_CALLEVEL if no
+*                            task is running or at interrupt level, E_OS_ACCESS if the
+*                            task is not a user of the resource or the resource is
+*                            already taken
+* Description: Function to take a resource with the immediate priority ceiling protocol.
+*              The calling task is raised to the priority of the highest priority user,
+*              so the other users cannot preempt it until ReleaseResource and a higher
+*              priority user is blocked at most once, by one critical section. A resource
+*              shared with the interrupts also masks the Os interrupts.
+*              An interrupt cannot take a resource: the task it interrupted would
+*              become the owner.
+************************************************************************************/
+StatusType GetResource(ResourceType ResID)
+{
+    StatusType result = E_OS_ID;
+    TaskType task_id = g_Running_Task;
+    TaskType ceiling;
+
+    if(ResID < OS_CONFIGURED_RESOURCES)
+    {
+	SuspendOSInterrupts();
+	if((task_id == OS_IDLE_TASK_ID) || (Os_Port_InInterrupt() == TRUE))
+	{
+	    result = E_OS_CALLEVEL;
+	}
+	else if(((Os_ResourceConfiguration[ResID].Users & OS_TASK_MASK(task_id)) == 0U) || (g_Resource_State[ResID].Owner != OS_IDLE_TASK_ID))
+	{
+	    result = E_OS_ACCESS;
+	}
+	else
+	{
+	    g_Resource_State[ResID].Owner             = task_id;
+	    g_Resource_State[ResID].Previous_Priority = g_Task_Priority[task_id];
+	    g_Resource_State[ResID].Previous_Resource = g_Task_Last_Resource[task_id];
+	    g_Task_Last_Resource[task_id] = ResID;
+	    g_Resource_Holders |= OS_TASK_MASK(task_id);
+
+	    /* The ceiling is the priority of the highest priority user */
+	    ceiling = Os_FindFirstTask(Os_ResourceConfiguration[ResID].Users);
+	    if(ceiling < g_Task_Priority[task_id])
+	    {
+		g_Task_Priority[task_id] = ceiling;
+	    }
+
+	    if(Os_ResourceConfiguration[ResID].Isr_Users == TRUE)
+	    {
+		/* Keep the Os interrupts masked until ReleaseResource */
+		SuspendOSInterrupts();
+	    }
+#if (OS_TASK_STATS == STD_ON)
+	    g_Resource_State[ResID].Start_Time = Os_Port_GetTimestamp();
+#endif
+	    result = E_OK;
+	}
+	ResumeOSInterrupts();
+    }
+    return result;
+}
+
+/************************************************************************************
+* Service Name: ReleaseResource
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ResID - Index of the resource in the Os resource table
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: StatusType - E_OK, E_OS_ID for an invalid resource, E_OS_CALLEVEL if no
+*                            task is running or at interrupt level, E_OS_ACCESS if the
+*                            task is not a user of the resource or E_OS_NOFUNC if it is
+*                            not the last resource taken by the task
+* Description: Function to release a resource taken by the calling task. The task goes
+*              back to its priority before GetResource and a higher priority task kept
+*              out by the ceiling preempts it.
+************************************************************************************/
+StatusType ReleaseResource(ResourceType ResID)
+{
+    StatusType result = E_OS_ID;
+    TaskType task_id = g_Running_Task;
+
+    if(ResID < OS_CONFIGURED_RESOURCES)
+    {
+	SuspendOSInterrupts();
+	if((task_id == OS_IDLE_TASK_ID) || (Os_Port_InInterrupt() == TRUE))
+	{
+	    result = E_OS_CALLEVEL;
+	}
+	else if((Os_ResourceConfiguration[ResID].Users & OS_TASK_MASK(task_id)) == 0U)
+	{
+	    result = E_OS_ACCESS;
+	}
+	else if((g_Resource_State[ResID].Owner != task_id) || (g_Task_Last_Resource[task_id] != ResID))
+	{
+	    result = E_OS_NOFUNC;
+	}
+	else
+	{
+	    Os_FreeResource(ResID);
+	    result = E_OK;
+	}
+	ResumeOSInterrupts();
+    }
+    return result;
+}
+
+/************************************************************************************
+* Service Name: GetCounterValue
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): CounterID - Counter identifier
+* Parameters (inout): None
+* Parameters (out): Value - Current counter value in ticks
+* Return value: StatusType - E_OK or E_OS_ID for an invalid counter or a NULL pointer
+* Description: Function to read the current value of a counter.
+************************************************************************************/
+StatusType GetCounterValue(CounterType CounterID, TickRefType Value)
+{
+    StatusType result = E_OS_ID;
+
+    if((CounterID < OS_CONFIGURED_COUNTERS) && (Value != NULL_PTR))
+    {
+	*Value = g_Time_Tick_Count;
+	result = E_OK;
+    }
+    return result;
+}
+
+/************************************************************************************
+* Service Name: SetRelAlarm
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): AlarmID   - Index of the alarm in the Os alarm table
+*                  Increment - Ticks from now to the first expiry
+*                  Cycle     - Ticks between the next expiries, 0 for a single shot alarm
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: StatusType - E_OK, E_OS_ID for an invalid alarm, E_OS_STATE if the alarm
+*                            is in use or E_OS_VALUE if Increment is 0
+* Description: Function to arm an alarm relative to the current counter value.
+************************************************************************************/
+StatusType SetRelAlarm(AlarmType AlarmID, TickType Increment, TickType Cycle)
+{
+    StatusType result = E_OS_ID;
+
+    if(AlarmID < OS_CONFIGURED_ALARMS)
+    {
+	if(Increment == 0U)
+	{
+	    result = E_OS_VALUE;
+	}
+	else
+	{
+	    result = Os_ArmAlarm(AlarmID, g_Wheel_Time + Increment, Cycle);
+	}
+    }
+    return result;
+}
+
+/************************************************************************************
+* Service Name: SetAbsAlarm
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): AlarmID - Index of the alarm in the Os alarm table
+*                  Start   - Counter value of the first expiry
+*                  Cycle   - Ticks between the next expiries, 0 for a single shot alarm
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: StatusType - E_OK, E_OS_ID for an invalid alarm or E_OS_STATE if the
+*                            alarm is in use
+* Description: Function to arm an alarm at an absolute counter value.
+************************************************************************************/
+StatusType SetAbsAlarm(AlarmType AlarmID, TickType Start, TickType Cycle)
+{
+    StatusType result = E_OS_ID;
+
+    if(AlarmID < OS_CONFIGURED_ALARMS)
+    {
+	result = Os_ArmAlarm(AlarmID, Start, Cycle);
+    }
+    return result;
+}
+
+/************************************************************************************
+* Service Name: CancelAlarm
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): AlarmID - Index of the alarm in the Os alarm table
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: StatusType - E_OK, E_OS_ID for an invalid alarm or E_OS_NOFUNC if the
+*                            alarm is not in use
+* Description: Function to disarm an alarm.
+************************************************************************************/
+StatusType CancelAlarm(AlarmType AlarmID)
+{
+    StatusType result = E_OS_ID;
+
+    if(AlarmID < OS_CONFIGURED_ALARMS)
+    {
+	SuspendOSInterrupts();
+	if(g_Alarm_State[AlarmID].Slot == OS_WHEEL_NO_SLOT)
+	{
+	    result = E_OS_NOFUNC;
+	}
+	else
+	{
+	    Os_WheelRemove(AlarmID);
+	    g_Armed_Alarms--;
+	    result = E_OK;
+	}
+	ResumeOSInterrupts();
+    }
+    return result;
+}
+
+/************************************************************************************
+* Service Name: GetAlarm
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): AlarmID - Index of the alarm in the Os alarm table
+* Parameters (inout): None
+* Parameters (out): Tick - Ticks left until the alarm expires
+* Return value: StatusType - E_OK, E_OS_ID for an invalid alarm or a NULL pointer or
+*                            E_OS_NOFUNC if the alarm is not in use
+* Description: Function to read the time left until an alarm expires.
+************************************************************************************/
+StatusType GetAlarm(AlarmType AlarmID, TickRefType Tick)
+{
+    StatusType result = E_OS_ID;
+
+    if((AlarmID < OS_CONFIGURED_ALARMS) && (Tick != NULL_PTR))
+    {
+	SuspendOSInterrupts();
+	if(g_Alarm_State[AlarmID].Slot == OS_WHEEL_NO_SLOT)
+	{
+	    result = E_OS_NOFUNC;
+	}
+	else
+	{
+	    *Tick  = g_Alarm_State[AlarmID].Expiry - g_Wheel_Time;
+	    result = E_OK;
+	}
+	ResumeOSInterrupts();
+    }
+    return result;
+}
+
+/************************************************************************************
+* Service Name: StartScheduleTableRel
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ScheduleTableID - Index of the table in the Os schedule table table
+*                  Offset          - Ticks from now to the start of the first round
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: StatusType - E_OK, E_OS_ID for an invalid table, E_OS_VALUE if Offset
+*                            is 0 or E_OS_STATE if the table is not stopped
+* Description: Function to start a schedule table relative to the current counter value.
+************************************************************************************/
+StatusType StartScheduleTableRel(ScheduleTableType ScheduleTableID, TickType Offset)
+{
+    StatusType result = E_OS_ID;
+
+    if(ScheduleTableID < OS_CONFIGURED_SCHEDULE_TABLES)
+    {
+	if(Offset == 0U)
+	{
+	    result = E_OS_VALUE;
+	}
+	else
+	{
+	    result = Os_StartScheduleTable(ScheduleTableID, g_Wheel_Time + Offset);
+	}
+    }
+    return result;
+}
+
+/************************************************************************************
+* Service Name: StartScheduleTableAbs
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ScheduleTableID - Index of the table in the Os schedule table table
+*                  Start           - Counter value of the start of the first round
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: StatusType - E_OK, E_OS_ID for an invalid table or E_OS_STATE if the
+*                            table is not stopped
+* Description: Function to start a schedule table at an absolute counter value.
+*              A value already reached starts the table when the counter reaches it
+*              again after wrapping.
+************************************************************************************/
+StatusType StartScheduleTableAbs(ScheduleTableType ScheduleTableID, TickType Start)
+{
+    StatusType result = E_OS_ID;
+
+    if(ScheduleTableID < OS_CONFIGURED_SCHEDULE_TABLES)
+    {
+	result = Os_StartScheduleTable(ScheduleTableID, Start);
+    }
+    return result;
+}
+
+/************************************************************************************
+* Service Name: StopScheduleTable
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ScheduleTableID - Index of the table in the Os schedule table table
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: StatusType - E_OK, E_OS_ID for an invalid table or E_OS_NOFUNC if the
+*                            table is stopped
+* Description: Function to stop a schedule table immediately, the table waiting to
+*              follow it is stopped too.
+************************************************************************************/
+StatusType StopScheduleTable(ScheduleTableType ScheduleTableID)
+{
+    StatusType result = E_OS_ID;
+    Os_ScheduleTableStateType * table;
+
+    if(ScheduleTableID < OS_CONFIGURED_SCHEDULE_TABLES)
+    {
+	table = &g_Schedule_Table_State[ScheduleTableID];
+
+	SuspendOSInterrupts();
+	if(table->Status == SCHEDULETABLE_STOPPED)
+	{
+	    result = E_OS_NOFUNC;
+	}
+	else
+	{
+	    if(table->Next_Table != OS_SCHEDULE_TABLE_NONE)
+	    {
+		g_Schedule_Table_State[table->Next_Table].Status = SCHEDULETABLE_STOPPED;
+		table->Next_Table = OS_SCHEDULE_TABLE_NONE;
+	    }
+	    table->Status     = SCHEDULETABLE_STOPPED;
+	    g_Running_Tables &= ~(1UL << ScheduleTableID);
+	    result = E_OK;
+	}
+	ResumeOSInterrupts();
+    }
+    return result;
+}
+
+/************************************************************************************
+* Service Name: NextScheduleTable
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ScheduleTableID_From - Running table
+*                  ScheduleTableID_To   - Table started at the end of the current round
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: StatusType - E_OK, E_OS_ID for an invalid table, E_OS_NOFUNC if the
+*                            first table is not running or E_OS_STATE if the second
+*                            table is not stopped
+* Description: Function to switch between schedule tables at a frame boundary, without
+*              stopping the Os. A table already waiting to follow the first one is
+*              replaced and goes back to the stopped state.
+************************************************************************************/
+StatusType NextScheduleTable(ScheduleTableType ScheduleTableID_From, ScheduleTableType ScheduleTableID_To)
+{
+    StatusType result = E_OS_ID;
+    Os_ScheduleTableStateType * from_table;
+
+    if((ScheduleTableID_From < OS_CONFIGURED_SCHEDULE_TABLES) && (ScheduleTableID_To < OS_CONFIGURED_SCHEDULE_TABLES))
+    {
+	from_table = &g_Schedule_Table_State[ScheduleTableID_From];
+
+	SuspendOSInterrupts();
+	if(from_table->Status != SCHEDULETABLE_RUNNING)
+	{
+	    result = E_OS_NOFUNC;
+	}
+	else if(g_Schedule_Table_State[ScheduleTableID_To].Status != SCHEDULETABLE_STOPPED)
+	{
+	    result = E_OS_STATE;
+	}
+	else
+	{
+	    if(from_table->Next_Table != OS_SCHEDULE_TABLE_NONE)
+	    {
+		g_Schedule_Table_State[from_table->Next_Table].Status = SCHEDULETABLE_STOPPED;
+	    }
+	    from_table->Next_Table = ScheduleTableID_To;
+	    g_Schedule_Table_State[ScheduleTableID_To].Status     = SCHEDULETABLE_NEXT;
+	    g_Schedule_Table_State[ScheduleTableID_To].Next_Table = OS_SCHEDULE_TABLE_NONE;
+	    result = E_OK;
+	}
+	ResumeOSInterrupts();
+    }
+    return result;
+}
+
+/************************************************************************************
+* Service Name: GetScheduleTableStatus
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ScheduleTableID - Index of the table in the Os schedule table table
+* Parameters (inout): None
+* Parameters (out): ScheduleStatus - State of the table
+* Return value: StatusType - E_OK or E_OS_ID for an invalid table or a NULL pointer
+* Description: Function to read the state of a schedule table.
+************************************************************************************/
+StatusType GetScheduleTableStatus(ScheduleTableType ScheduleTableID, ScheduleTableStatusRefType ScheduleStatus)
+{
+    StatusType result = E_OS_ID;
+
+    if((ScheduleTableID < OS_CONFIGURED_SCHEDULE_TABLES) && (ScheduleStatus != NULL_PTR))
+    {
+	*ScheduleStatus = g_Schedule_Table_State[ScheduleTableID].Status;
+	result = E_OK;
+    }
+    return result;
+}
+
+/************************************************************************************
+* Service Name: Os_GetTaskOverruns
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Task_Id - Index of the task in the Os task table
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Number of overruns of the task (0 for an invalid task)
+* Description: Function to get how many times a task was still running when its
+*              next tick (or its next release in the preemptive kernel) arrived.
+************************************************************************************/
+uint32 Os_GetTaskOverruns(TaskType Task_Id)
+{
+    uint32 overruns = 0;
+
+    if(Task_Id < OS_CONFIGURED_TASKS)
+    {
+	overruns = g_Task_Overruns[Task_Id];
+    }
+    return overruns;
+}
+
+/************************************************************************************
+* Service Name: Os_GetTimeUs
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint64 - Monotonic Os time in microseconds since the Os start (since
+*                        Gpt_Init with OS_GPT_TIME)
+* Description: Function to get a microsecond timestamp from the Os tick count and
+*              the SysTick counter, or from the Gpt predefined timer. It can be called
+*              from tasks and ISRs without masking interrupts: the read is repeated if
+*              a tick happens meanwhile.
+************************************************************************************/
+uint64 Os_GetTimeUs(void)
+{
+#if (OS_GPT_TIME == STD_ON)
+    return Gpt_GetPredefTimerValue64() / OS_GPT_TICKS_PER_US;
+#else
+    TickType ticks;
+    uint32 wraps;
+    uint32 elapsed_us;
+
+    do
+    {
+	ticks      = g_Time_Tick_Count;
+	wraps      = g_Time_Tick_Wraps;
+	elapsed_us = SysTick_GetElapsedTimeUs();
+    } while(ticks != g_Time_Tick_Count);
+
+    return (((((uint64)wraps) << 32) | ticks) * OS_BASE_TIME_US) + elapsed_us;
+#endif
+}
+
+/************************************************************************************
+* Service Name: Os_GetElapsedTime
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Start_Time - A previous value returned by Os_GetTimeUs
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint64 - Microseconds elapsed since Start_Time
+* Description: Function to measure a latency or check a timeout.
+************************************************************************************/
+uint64 Os_GetElapsedTime(uint64 Start_Time)
+{
+    return Os_GetTimeUs() - Start_Time;
+}
@@ -12,12 +12,286 @@
 #ifndef OS_H_
 #define OS_H_
 
+/* Os Module Id */
+#define OS_MODULE_ID        (1U)
+
+/* Os Instance Id */
+#define OS_INSTANCE_ID      (0U)
+
 #include "Std_Types.h"
 
-/* Timer counting time in ms */
-#define OS_BASE_TIME 20
+/* Os Pre-Compile Configuration Header file */
+#include "Os_Cfg.h"
+
+/*******************************************************************************
+ *                      API Service Id Macros                                  *
+ *******************************************************************************/
+/* Service ID for the Os overrun hook */
+#define OS_OVERRUN_HOOK_SID     (uint8)0x00
+
+/* Service ID for the Os stack overflow hook */
+#define OS_STACK_OVERFLOW_HOOK_SID  (uint8)0x01
+
+/*******************************************************************************
+ *                      Os Service Status Codes                                *
+ *******************************************************************************/
+/* E_OK (Std_Types.h) is returned when the service succeeds */
+
+/* Service called with the wrong object or from the wrong context */
+#define E_OS_ACCESS             (StatusType)0x01
+
+/* Service called from the idle loop, it shall be called from a task */
+#define E_OS_CALLEVEL           (StatusType)0x02
+
+/* Invalid task, alarm or counter identifier */
+#define E_OS_ID                 (StatusType)0x03
+
+/* The task has already an activation which did not end yet */
+#define E_OS_LIMIT              (StatusType)0x04
+
+/* The alarm is not in use */
+#define E_OS_NOFUNC             (StatusType)0x05
+
+/* The task holds a resource */
+#define E_OS_RESOURCE           (StatusType)0x06
+
+/* The alarm is already in use */
+#define E_OS_STATE              (StatusType)0x07
+
+/* A parameter is outside the allowed values */
+#define E_OS_VALUE              (StatusType)0x08
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* DET code to report a task still running when its next tick arrived */
+#define OS_E_OVERRUN            (uint8)0x01
+
+/* DET code to report a stack which reached its guard zone */
+#define OS_E_STACK_OVERFLOW     (uint8)0x02
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for the status returned by the Os services */
+typedef uint8 StatusType;
+
+/* Type definition for the task identifier (index in the Os task table) */
+typedef uint8 TaskType;
+
+/* Type definition for a pointer to a task identifier */
+typedef TaskType * TaskRefType;
+
+/* Type definition for the events of a task, bit n represents the event n */
+typedef uint32 EventMaskType;
+
+/* Type definition for a pointer to the events of a task */
+typedef EventMaskType * EventMaskRefType;
+
+/* Context identifier of the idle loop, used when no task is ready */
+#define OS_IDLE_TASK_ID     ((TaskType)OS_CONFIGURED_TASKS)
+
+/*
+ * Stack identifiers used by the stack monitoring: a task stack (preemptive kernel) has the
+ * task index, the idle context stack OS_IDLE_TASK_ID and the main stack (CSTACK), used by
+ * the startup code, the interrupts and the cooperative scheduler, OS_MAIN_STACK_ID.
+ */
+#define OS_MAIN_STACK_ID    ((uint8)(OS_CONFIGURED_TASKS + 1U))
+#define OS_STACKS_COUNT     (OS_CONFIGURED_TASKS + 2U)
+
+/* Type definition for the Os time counted in ticks of OS_BASE_TIME_US */
+typedef uint32 TickType;
+
+/* Type definition for a pointer to a counter or alarm value */
+typedef TickType * TickRefType;
+
+/* Type definition for the counter identifier */
+typedef uint8 CounterType;
+
+/* Type definition for the alarm identifier (index in the Os alarm table) */
+typedef uint16 AlarmType;
+
+/* Type definition for the resource identifier (index in the Os resource table) */
+typedef uint8 ResourceType;
+
+/* Type definition for the schedule table identifier (index in the Os schedule table table) */
+typedef uint8 ScheduleTableType;
+
+/* Type definition for the state of a schedule table */
+typedef uint8 ScheduleTableStatusType;
 
-/* Description: 
+/* Type definition for a pointer to the state of a schedule table */
+typedef ScheduleTableStatusType * ScheduleTableStatusRefType;
+
+/* States of a schedule table */
+#define SCHEDULETABLE_STOPPED   (ScheduleTableStatusType)0x00   /* Not started */
+#define SCHEDULETABLE_NEXT      (ScheduleTableStatusType)0x01   /* Starts when the current table ends its round */
+#define SCHEDULETABLE_RUNNING   (ScheduleTableStatusType)0x02   /* Processing its expiry points */
+
+/* Actions done by an alarm when it expires */
+#define OS_ALARM_ACTIVATETASK   (0U)    /* ActivateTask(Task_Id) */
+#define OS_ALARM_SETEVENT       (1U)    /* SetEvent(Task_Id, Event) */
+#define OS_ALARM_CALLBACK       (2U)    /* Callback_Ptr() in the tick interrupt */
+
+/* Type definition for a set of tasks, bit n represents the task with index n */
+typedef uint32 Os_TaskMaskType;
+
+/* Structure describes one periodic task of the Os */
+typedef struct
+{
+    /* Task entry point */
+    void (*Task_Ptr)(void);
+    /* Task period in Os ticks */
+    TickType Period;
+    /* First release of the task in Os ticks inside its period */
+    TickType Offset;
+} Os_TaskConfigType;
+
+/* Structure describes the expiry action of one alarm */
+typedef struct
+{
+    /* OS_ALARM_ACTIVATETASK, OS_ALARM_SETEVENT or OS_ALARM_CALLBACK */
+    uint8 Action;
+    /* Task activated or receiving the event */
+    TaskType Task_Id;
+    /* Event set by OS_ALARM_SETEVENT */
+    EventMaskType Event;
+    /* Function called by OS_ALARM_CALLBACK */
+    void (*Callback_Ptr)(void);
+} Os_AlarmConfigType;
+
+/* Structure describes one resource */
+typedef struct
+{
+    /* Set of the tasks allowed to take the resource, the highest priority one gives its ceiling */
+    Os_TaskMaskType Users;
+    /* TRUE if an interrupt calling the Os services also uses the shared object: the owner masks them too */
+    boolean Isr_Users;
+} Os_ResourceConfigType;
+
+/* Structure describes one expiry point of a schedule table */
+typedef struct
+{
+    /* Ticks from the start of the table round */
+    TickType Offset;
+    /* Set of the tasks activated at the expiry point */
+    Os_TaskMaskType Activated_Tasks;
+} Os_ExpiryPointType;
+
+/* Structure describes one schedule table */
+typedef struct
+{
+    /* Expiry points sorted by their offset */
+    const Os_ExpiryPointType * Expiry_Points;
+    /* Number of the expiry points */
+    uint8 Expiry_Points_Count;
+    /* Length of one round in Os ticks */
+    TickType Duration;
+    /* TRUE: a new round starts at the end of every round, FALSE: the table stops after one round */
+    boolean Repeating;
+} Os_ScheduleTableConfigType;
+
+/* Macro converts a task index to its bit in a set of tasks */
+#define OS_TASK_MASK(TASK_ID)   ((Os_TaskMaskType)1UL << (TASK_ID))
+
+/* Execution time statistics of one task in timestamp units (CPU cycles on the target) */
+typedef struct
+{
+    /* Number of the completed executions */
+    uint32 Count;
+    /* Shortest execution time */
+    uint32 Min_Time;
+    /* Longest execution time (observed WCET) */
+    uint32 Max_Time;
+    /* Average execution time */
+    uint32 Mean_Time;
+} Os_TaskStatsType;
+
+/* Use of one stack in bytes */
+typedef struct
+{
+    /* Size of the stack */
+    uint32 Size;
+    /* Deepest use since the Os start (high-water mark) */
+    uint32 Max_Used;
+} Os_StackUsageType;
+
+/* Hold time statistics of one resource in timestamp units (CPU cycles on the target) */
+typedef struct
+{
+    /* Number of the GetResource calls */
+    uint32 Count;
+    /* Longest time from GetResource to ReleaseResource, including the preemption by the higher priority tasks */
+    uint32 Max_Hold_Time;
+} Os_ResourceStatsType;
+
+/* Longest interrupt lock time of one call site in timestamp units (CPU cycles on the target) */
+typedef struct
+{
+    /* Source file and line of the outermost Suspend call, File is NULL_PTR for an unused entry */
+    const char * File;
+    uint16 Line;
+    /* Number of the locks taken at this site */
+    uint32 Count;
+    /* Longest time from the Suspend call to the matching Resume call */
+    uint32 Max_Time;
+} Os_LockTraceType;
+
+/* CPU load in 0.1 % units (1000 is a fully loaded CPU) */
+typedef struct
+{
+    /* Load of the last complete window of OS_CPU_LOAD_WINDOW_TICKS ticks */
+    uint16 Load;
+    /* Highest load of the last OS_CPU_LOAD_PEAK_WINDOWS windows */
+    uint16 Peak_Load;
+} Os_CpuLoadType;
+
+/* Release jitter histogram of one task in microseconds */
+typedef struct
+{
+    /* Number of the recorded releases */
+    uint32 Count;
+    /* Longest delay from the nominal release to the task start */
+    uint32 Max_Latency;
+    /* Bucket n counts the delays in [n, n+1) * OS_JITTER_BUCKET_WIDTH_US, the last one the longer delays too */
+    uint32 Buckets[OS_JITTER_BUCKETS];
+} Os_JitterHistogramType;
+
+/*
+ * Macro evaluates to 1 if a task with the given period and offset is released
+ * in the given tick of the hyperperiod, used to build the dispatch table at compile time.
+ * A task with OS_TASK_NOT_PERIODIC period is never released by the tick.
+ */
+#define OS_TASK_RELEASED(TICK,PERIOD,OFFSET)    \
+    (((PERIOD) == OS_TASK_NOT_PERIODIC) ? 0UL : ((((TICK) % (PERIOD)) == (OFFSET)) ? 1UL : 0UL))
+
+/*
+ * Macro evaluates to the worst case execution time a task adds to the given tick of the
+ * hyperperiod. A non periodic task may be activated in any tick so it is always counted.
+ */
+#define OS_TASK_FRAME_LOAD(TICK,PERIOD,OFFSET,WCET)    \
+    (((PERIOD) == OS_TASK_NOT_PERIODIC) ? (WCET) : (OS_TASK_RELEASED(TICK,PERIOD,OFFSET) * (WCET)))
+
+/* Macro evaluates to 1 if a task period divides the configured OS_HYPERPERIOD_TICKS (Os_Cfg.h), a non periodic task always does */
+#define OS_PERIOD_DIVIDES_HYPERPERIOD(PERIOD)    \
+    (((PERIOD) == OS_TASK_NOT_PERIODIC) || ((OS_HYPERPERIOD_TICKS % (PERIOD)) == 0U))
+
+/* Longest hyperperiod in Os ticks, the dispatch table of Os_PBcfg.c is generated by blocks of 1024 ticks down to 1 tick */
+#define OS_MAX_HYPERPERIOD_TICKS    (2047U)
+
+#if (OS_HYPERPERIOD_TICKS == 0U) || (OS_HYPERPERIOD_TICKS > OS_MAX_HYPERPERIOD_TICKS)
+#error "OS_HYPERPERIOD_TICKS shall be between 1 and OS_MAX_HYPERPERIOD_TICKS"
+#endif
+
+/* Length of one tick of the hyperperiod in microseconds */
+#define OS_FRAME_TIME_US        (OS_BASE_TIME_US)
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Description:
  * Function responsible for:
  * 1. Enable Interrupts
  * 2. Start the Os timer
@@ -32,4 +306,246 @@ void Os_Scheduler(void);
 /* Description: Function called by the Timer Driver in the MCAL layer using the call back pointer */
 void Os_NewTimerTick(void);
 
+/* Description: Return the monotonic Os time in microseconds (tick count plus the running SysTick period, or the Gpt predefined timer) */
+uint64 Os_GetTimeUs(void);
+
+/* Description: Return the microseconds elapsed since Start_Time, a previous value of Os_GetTimeUs */
+uint64 Os_GetElapsedTime(uint64 Start_Time);
+
+/*
+ * Description: Activate a task, it runs as soon as it is the highest priority ready task.
+ *              Return E_OS_ID for an invalid task or E_OS_LIMIT if the task is already
+ *              activated and did not end yet. Can be called from tasks and ISRs.
+ */
+StatusType ActivateTask(TaskType TaskID);
+
+/*
+ * Description: Copy the identifier of the running task, OS_IDLE_TASK_ID outside a task.
+ *              Return E_OS_VALUE for a NULL pointer.
+ */
+StatusType GetTaskID(TaskRefType TaskID);
+
+/*
+ * Description: Set events of a task. A task waiting for one of them becomes ready,
+ *              otherwise the events are kept until the task clears them.
+ *              Return E_OS_ID for an invalid task. Can be called from tasks and ISRs.
+ */
+StatusType SetEvent(TaskType TaskID, EventMaskType Mask);
+
+/* Description: Clear events of the calling task, return E_OS_CALLEVEL outside a task */
+StatusType ClearEvent(EventMaskType Mask);
+
+/* Description: Copy the current events of a task, return E_OS_ID for an invalid task or a NULL pointer */
+StatusType GetEvent(TaskType TaskID, EventMaskRefType Event);
+
+/*
+ * Description: Block the calling task until one of the events in Mask is set.
+ *              Return E_OS_CALLEVEL outside a task, E_OS_RESOURCE if the task holds a
+ *              resource or E_OS_ACCESS if it masks the interrupts. A task of the cooperative scheduler
+ *              shares the stack of the scheduler and cannot block: if none of the events
+ *              is set it returns E_OS_ACCESS, the task shall then end and be activated again.
+ */
+StatusType WaitEvent(EventMaskType Mask);
+
+/* Description: Copy the current value of a counter, return E_OS_ID for an invalid counter or a NULL pointer */
+StatusType GetCounterValue(CounterType CounterID, TickRefType Value);
+
+/*
+ * Description: Arm an alarm to expire Increment ticks from now, then every Cycle ticks (0 for a single shot).
+ *              Return E_OS_ID for an invalid alarm, E_OS_STATE if the alarm is in use or
+ *              E_OS_VALUE if Increment is 0.
+ */
+StatusType SetRelAlarm(AlarmType AlarmID, TickType Increment, TickType Cycle);
+
+/*
+ * Description: Arm an alarm to expire when the system counter reaches Start, then every Cycle ticks.
+ *              A Start value already reached expires when the counter reaches it again after wrapping.
+ *              Return E_OS_ID for an invalid alarm or E_OS_STATE if the alarm is in use.
+ */
+StatusType SetAbsAlarm(AlarmType AlarmID, TickType Start, TickType Cycle);
+
+/* Description: Disarm an alarm, return E_OS_ID for an invalid alarm or E_OS_NOFUNC if it is not in use */
+StatusType CancelAlarm(AlarmType AlarmID);
+
+/* Description: Copy the ticks left until an alarm expires, return E_OS_NOFUNC if it is not in use */
+StatusType GetAlarm(AlarmType AlarmID, TickRefType Tick);
+
+/*
+ * Description: Start a schedule table Offset ticks from now, return E_OS_ID for an invalid table,
+ *              E_OS_VALUE if Offset is 0 or E_OS_STATE if the table is not stopped.
+ */
+StatusType StartScheduleTableRel(ScheduleTableType ScheduleTableID, TickType Offset);
+
+/*
+ * Description: Start a schedule table when the system counter reaches Start, return E_OS_ID for
+ *              an invalid table or E_OS_STATE if the table is not stopped.
+ */
+StatusType StartScheduleTableAbs(ScheduleTableType ScheduleTableID, TickType Start);
+
+/*
+ * Description: Stop a schedule table and the table started after it by NextScheduleTable.
+ *              Return E_OS_ID for an invalid table or E_OS_NOFUNC if the table is stopped.
+ */
+StatusType StopScheduleTable(ScheduleTableType ScheduleTableID);
+
+/*
+ * Description: Switch from a running table to another one at the end of the current round of the first,
+ *              so the mode changes at a frame boundary. Return E_OS_ID for an invalid table,
+ *              E_OS_NOFUNC if the first table is not running or E_OS_STATE if the second is not stopped.
+ */
+StatusType NextScheduleTable(ScheduleTableType ScheduleTableID_From, ScheduleTableType ScheduleTableID_To);
+
+/* Description: Copy the state of a schedule table, return E_OS_ID for an invalid table or a NULL pointer */
+StatusType GetScheduleTableStatus(ScheduleTableType ScheduleTableID, ScheduleTableStatusRefType ScheduleStatus);
+
+/*
+ * Description: Take a resource with the immediate priority ceiling protocol: until ReleaseResource
+ *              the calling task runs at the priority of the highest priority task using the resource,
+ *              so no other user can preempt it. Return E_OS_ID for an invalid resource,
+ *              E_OS_CALLEVEL outside a task (before the scheduler runs or at interrupt level) or E_OS_ACCESS if the task is not a user of the
+ *              resource or the resource is already taken.
+ */
+StatusType GetResource(ResourceType ResID);
+
+/*
+ * Description: Release a resource taken by the calling task, the resources are released in the
+ *              reverse order of GetResource. Return E_OS_ID for an invalid resource, E_OS_CALLEVEL
+ *              outside a task (before the scheduler runs or at interrupt level), E_OS_ACCESS if the task is not a user of the resource or E_OS_NOFUNC
+ *              if it is not the last resource taken by the task.
+ */
+StatusType ReleaseResource(ResourceType ResID);
+
+/*
+ * Description: Mask all the interrupts (PRIMASK). The calls can be nested, the interrupts
+ *              are unmasked again by the ResumeAllInterrupts matching the outermost call.
+ */
+#if (OS_INTERRUPT_LOCK_TRACE == STD_ON)
+void Os_SuspendAllInterruptsSite(const char * File, uint16 Line);
+#define SuspendAllInterrupts()  Os_SuspendAllInterruptsSite(__FILE__, (uint16)__LINE__)
+#else
+void SuspendAllInterrupts(void);
+#endif
+
+/* Description: Leave the critical section of the matching SuspendAllInterrupts */
+void ResumeAllInterrupts(void);
+
+/*
+ * Description: Mask the interrupts calling the Os services (BASEPRI, see OS_ISR_PRIORITY_LIMIT),
+ *              the interrupts with a higher priority keep running. The calls can be nested, the
+ *              interrupts are unmasked again by the ResumeOSInterrupts matching the outermost call.
+ */
+#if (OS_INTERRUPT_LOCK_TRACE == STD_ON)
+void Os_SuspendOSInterruptsSite(const char * File, uint16 Line);
+#define SuspendOSInterrupts()   Os_SuspendOSInterruptsSite(__FILE__, (uint16)__LINE__)
+#else
+void SuspendOSInterrupts(void);
+#endif
+
+/* Description: Leave the critical section of the matching SuspendOSInterrupts */
+void ResumeOSInterrupts(void);
+
+/* Description: Return how many times a task overran, i.e. was still running when its next tick arrived */
+uint32 Os_GetTaskOverruns(TaskType Task_Id);
+
+#if (OS_OVERRUN_POLICY == OS_OVERRUN_HOOK)
+/*
+ * Description: Hook provided by the application, called with the task that overran.
+ *              Called by the scheduler in the cooperative mode and by the tick interrupt
+ *              in the preemptive kernel.
+ */
+void Os_OverrunHook(TaskType Task_Id);
+#endif
+
+#if (OS_TASK_STATS == STD_ON)
+/*
+ * Description: Copy the execution time statistics of a task.
+ *              Return E_NOT_OK for an invalid task or a NULL pointer.
+ *              The time is in CPU cycles, preemption by other tasks is not counted.
+ */
+Std_ReturnType Os_GetTaskStats(TaskType Task_Id, Os_TaskStatsType * Stats);
+
+/* Description: Clear the execution time statistics of all the tasks and the resources */
+void Os_ResetTaskStats(void);
+
+/*
+ * Description: Copy the hold time statistics of a resource, the longest hold time bounds the
+ *              blocking of the higher priority users. Return E_NOT_OK for an invalid resource
+ *              or a NULL pointer.
+ */
+Std_ReturnType Os_GetResourceStats(ResourceType ResID, Os_ResourceStatsType * Stats);
+#endif
+
+#if (OS_STACK_MONITOR == STD_ON)
+/*
+ * Description: Scan a stack then copy its size and high-water mark.
+ *              Return E_NOT_OK for a stack which is not used by the kernel or a NULL pointer.
+ */
+Std_ReturnType Os_GetStackUsage(uint8 Stack_Id, Os_StackUsageType * Usage);
+
+/*
+ * Description: Hook provided by the application, called once for a stack which wrote its
+ *              OS_STACK_GUARD_WORDS guard zone, before the variables below it are corrupted.
+ *              Called by the tick interrupt.
+ */
+void Os_StackOverflowHook(uint8 Stack_Id);
+#endif
+
+#if (OS_INTERRUPT_LOCK_TRACE == STD_ON)
+/*
+ * Description: Copy the entry Index (0 .. OS_LOCK_TRACE_SITES - 1) of the interrupt lock trace.
+ *              Return E_NOT_OK for an unused entry or a NULL pointer.
+ *              The time is in CPU cycles, the Os kernel critical sections are traced too.
+ */
+Std_ReturnType Os_GetLockTrace(uint8 Index, Os_LockTraceType * Trace);
+
+/* Description: Clear the interrupt lock trace */
+void Os_ResetLockTrace(void);
+#endif
+
+#if (OS_CPU_LOAD == STD_ON)
+/*
+ * Description: Copy the CPU load of the last window and the peak of the last windows.
+ *              Return E_NOT_OK for a NULL pointer or before the end of the first window.
+ */
+Std_ReturnType Os_GetCpuLoad(Os_CpuLoadType * Load);
+#endif
+
+#if (OS_JITTER_HISTOGRAM == STD_ON)
+/*
+ * Description: Copy the release jitter histogram of a task.
+ *              Return E_NOT_OK for an invalid task or a NULL pointer.
+ */
+Std_ReturnType Os_GetJitterHistogram(TaskType Task_Id, Os_JitterHistogramType * Histogram);
+
+/* Description: Clear the release jitter histograms of all the tasks */
+void Os_ResetJitterHistograms(void);
+
+#if defined(__linux__)
+/*
+ * Description: Write the release jitter histograms of all the tasks to a CSV file at the end
+ *              of a host simulation run. Return E_NOT_OK if the file cannot be written.
+ */
+Std_ReturnType Os_HostExportJitter(const char * File_Name);
+#endif
+#endif
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Task table used by the Os Scheduler, the task index is its dispatch order */
+extern const Os_TaskConfigType Os_TaskConfiguration[OS_CONFIGURED_TASKS];
+
+/* Set of the tasks released in each tick of the hyperperiod */
+extern const Os_TaskMaskType Os_DispatchTable[];
+
+/* Alarm table used by the Os counter, the alarm index is its identifier */
+extern const Os_AlarmConfigType Os_AlarmConfiguration[OS_CONFIGURED_ALARMS];
+
+/* Schedule tables driven by the Os counter, the table index is its identifier */
+extern const Os_ScheduleTableConfigType Os_ScheduleTableConfiguration[OS_CONFIGURED_SCHEDULE_TABLES];
+
+/* Resource table, the resource index is its identifier */
+extern const Os_ResourceConfigType Os_ResourceConfiguration[OS_CONFIGURED_RESOURCES];
+
 #endif /* OS_H_ */
@@ -0,0 +1,212 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for Os Scheduler.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef OS_CFG_H_
+#define OS_CFG_H_
+
+/*
+ * Os tick in microseconds (1000U for 1ms, 250U for 250us), 1 up to SYSTICK_MAX_START_TIME_US.
+ * A tick longer than SYSTICK_MAX_TICK_TIME_US is counted by the SysTick software extension.
+ */
+#define OS_BASE_TIME_US                     (20000UL)
+
+/*
+ * Pre-compile option for the time source of Os_GetTimeUs.
+ * STD_OFF: the Os tick count plus the time elapsed in the running SysTick period.
+ * STD_ON : the Gpt predefined timer (GPT_PREDEF_TIMER_API), a 64-bit counter read in
+ *          constant time. The Os time starts at Gpt_Init (Init_Task) and reads 0 before.
+ */
+#define OS_GPT_TIME                         (STD_OFF)
+
+/*
+ * Pre-compile option for the preemptive fixed-priority kernel.
+ * STD_OFF: tasks run to completion inside Os_Scheduler.
+ * STD_ON : every task has its own stack and is released from the tick interrupt,
+ *          a released task preempts any task with a higher index (lower priority).
+ */
+#define OS_PREEMPTIVE                       (STD_OFF)
+
+/*
+ * Pre-compile option for the tickless idle mode.
+ * STD_ON: the SysTick timer is reprogrammed to expire only at the next task release
+ *         and the CPU sleeps (WFI) while no task is ready.
+ */
+#define OS_TICKLESS_IDLE                    (STD_OFF)
+
+/*
+ * Pre-compile option for the task execution time statistics (Os_GetTaskStats).
+ * Every task start and end is timestamped with the DWT cycle counter,
+ * the resource hold times (Os_GetResourceStats) are measured too.
+ */
+#define OS_TASK_STATS                       (STD_OFF)
+
+/*
+ * Priority of the highest priority interrupt calling the Os services (the SysTick interrupt).
+ * SuspendOSInterrupts masks this priority and the lower ones, the interrupts with a higher
+ * priority (lower value) keep running. Shall be 1 or more, 0 is the highest priority.
+ */
+#define OS_ISR_PRIORITY_LIMIT               (3U)
+
+/*
+ * Pre-compile option for the interrupt lock tracing (Os_GetLockTrace).
+ * Every outermost Suspend/Resume pair is timestamped and the longest lock time
+ * of every call site (source file and line of the Suspend call) is kept.
+ */
+#define OS_INTERRUPT_LOCK_TRACE             (STD_OFF)
+
+/* Number of the call sites recorded by the interrupt lock tracing */
+#define OS_LOCK_TRACE_SITES                 (16U)
+
+/*
+ * Pre-compile option for the stack monitoring (Os_GetStackUsage).
+ * The stacks are painted at the Os start, the idle loop scans one stack per pass for its
+ * high-water mark and the tick interrupt checks the guard zone of every stack.
+ */
+#define OS_STACK_MONITOR                    (STD_OFF)
+
+/* Words at the bottom of every stack which shall stay unused, Os_StackOverflowHook is called once one is written */
+#define OS_STACK_GUARD_WORDS                (8U)
+
+/*
+ * Pre-compile option for the release jitter histograms (Os_GetJitterHistogram).
+ * The delay from the nominal release of every task (its tick, or the ActivateTask call)
+ * to its start is counted in OS_JITTER_BUCKETS buckets of OS_JITTER_BUCKET_WIDTH_US each,
+ * the last bucket counts all the longer delays.
+ */
+#define OS_JITTER_HISTOGRAM                 (STD_OFF)
+
+/* Number of the buckets of every release jitter histogram */
+#define OS_JITTER_BUCKETS                   (16U)
+
+/* Width of one bucket of the release jitter histograms in microseconds */
+#define OS_JITTER_BUCKET_WIDTH_US           (50U)
+
+/*
+ * Pre-compile option for the binary event trace (Os_Trace.h).
+ * The task begin/end, SysTick and Gpt timers interrupts enter/exit, Dio writes and Det reports are
+ * recorded with a timestamp in a ring buffer, decoded by Tools/Os_TraceDecoder.c.
+ */
+#define OS_TRACE                            (STD_OFF)
+
+/* Number of the records of the trace ring buffer (8 bytes each), a power of 2 */
+#define OS_TRACE_RECORDS                    (256U)
+
+/*
+ * Pre-compile option for the CPU load measurement (Os_GetCpuLoad).
+ * The idle loop timestamps its entry and exit, the tick interrupt computes the load
+ * of every window of OS_CPU_LOAD_WINDOW_TICKS ticks from the idle time of the window.
+ */
+#define OS_CPU_LOAD                         (STD_OFF)
+
+/* Length of one CPU load window in Os ticks */
+#define OS_CPU_LOAD_WINDOW_TICKS            (50U)   /* 1s */
+
+/* Number of the last windows giving the peak CPU load */
+#define OS_CPU_LOAD_PEAK_WINDOWS            (10U)
+
+/* Recovery policies when the tasks of a tick are still running at the next tick */
+#define OS_OVERRUN_SKIP                     (0U)    /* Drop the releases of the missed ticks */
+#define OS_OVERRUN_CATCH_UP                 (1U)    /* Run the tasks of the missed ticks in a burst */
+#define OS_OVERRUN_HOOK                     (2U)    /* Call Os_OverrunHook then drop the missed releases */
+
+/* Pre-compile option for the overrun recovery policy */
+#define OS_OVERRUN_POLICY                   (OS_OVERRUN_SKIP)
+
+/* Stack size in bytes of every task context used by the preemptive kernel */
+#define OS_TASK_STACK_SIZE                  (512U)
+
+/* Number of the configured Os Tasks */
+#define OS_CONFIGURED_TASKS                 (3U)
+
+/*
+ * Task Index in the array of structures in Os_PBcfg.c
+ * The index is also the task priority: lower index runs first (0 is the highest priority).
+ */
+#define OsConf_BUTTON_TASK_ID_INDEX         (uint8)0x00
+#define OsConf_APP_TASK_ID_INDEX            (uint8)0x01
+#define OsConf_LED_TASK_ID_INDEX            (uint8)0x02
+
+/* Period of a task which is never released by the tick, it only runs when activated by ActivateTask */
+#define OS_TASK_NOT_PERIODIC                (0U)
+
+/* Task periods in Os ticks (multiples of OS_BASE_TIME_US) */
+#define OsConf_BUTTON_TASK_PERIOD           (1U)    /* 20ms */
+#define OsConf_APP_TASK_PERIOD              (OS_TASK_NOT_PERIODIC)  /* Activated by the Button module */
+#define OsConf_LED_TASK_PERIOD              (2U)    /* 40ms */
+
+/*
+ * Task offsets in Os ticks, must be less than the task period.
+ * Tools/Os_OffsetPlanner.c chooses the offsets giving the smallest peak load of a tick.
+ */
+#define OsConf_BUTTON_TASK_OFFSET           (0U)
+#define OsConf_APP_TASK_OFFSET              (0U)
+#define OsConf_LED_TASK_OFFSET              (0U)
+
+/*
+ * Shortest time between two activations of a non periodic task in Os ticks, used by the
+ * schedulability analysis. The Button state needs 3 samples to change (60ms).
+ */
+#define OsConf_APP_TASK_MIN_INTERARRIVAL    (3U)
+
+/*
+ * Worst case execution times in microseconds, used by the schedulability analysis.
+ * Keep them above the Max_Time reported by Os_GetTaskStats (CPU cycles / 80 at 80Mhz).
+ */
+#define OsConf_BUTTON_TASK_WCET             (50U)
+#define OsConf_APP_TASK_WCET                (50U)
+#define OsConf_LED_TASK_WCET                (50U)
+
+/*
+ * Hyperperiod in Os ticks, the least common multiple of the periodic task periods (every period
+ * shall divide it, checked in Os_PBcfg.c). The dispatch table in Os_PBcfg.c holds one entry per tick of it.
+ */
+#define OS_HYPERPERIOD_TICKS                (2U)
+
+/* Number of the configured Os Alarms */
+#define OS_CONFIGURED_ALARMS                (1U)
+
+/* Alarm Index in the array of structures in Os_PBcfg.c */
+#define OsConf_APP_ALARM_ID_INDEX           (AlarmType)0x00
+
+/* Counter Index ... the system counter counts the Os ticks */
+#define OsConf_SYSTEM_COUNTER_ID            (CounterType)0x00
+
+/* Number of the configured Os Counters */
+#define OS_CONFIGURED_COUNTERS              (1U)
+
+/* Number of the configured Os Schedule Tables */
+#define OS_CONFIGURED_SCHEDULE_TABLES       (1U)
+
+/* Schedule Table Index in the array of structures in Os_PBcfg.c */
+#define OsConf_APP_SCHEDULE_TABLE_ID_INDEX  (ScheduleTableType)0x00
+
+/* Schedule table durations in Os ticks, every expiry point offset must be less than the duration */
+#define OsConf_APP_SCHEDULE_TABLE_DURATION  (3U)    /* 60ms */
+
+/* Number of the configured Os Resources */
+#define OS_CONFIGURED_RESOURCES             (1U)
+
+/* Resource Index in the array of structures in Os_PBcfg.c */
+#define OsConf_DIO_RESOURCE_ID_INDEX        (ResourceType)0x00
+
+/*
+ * Tasks sharing every resource ... the Dio port data registers are written by the App (toggle) and Led tasks,
+ * the Dio resource is also shared with the interrupts (Os_PBcfg.c): an interrupt may write a Dio channel.
+ */
+#define OsConf_DIO_RESOURCE_USERS           (OS_TASK_MASK(OsConf_APP_TASK_ID_INDEX) | OS_TASK_MASK(OsConf_LED_TASK_ID_INDEX))
+
+/*
+ * Longest time in microseconds a task holds every resource, used by the schedulability analysis
+ * as the blocking time of the higher priority users. Keep it above the Max_Hold_Time reported by Os_GetResourceStats.
+ */
+#define OsConf_DIO_RESOURCE_WCET            (5U)
+
+#endif /* OS_CFG_H_ */
@@ -0,0 +1,72 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Coroutine.c
+ *
+ * Description: Source file for the Os stackless coroutines (protothreads).
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Os_Coroutine.h"
+
+/* Half of the counter range, a later counter value is less than this distance ahead */
+#define OS_CO_HALF_RANGE    (0x80000000UL)
+
+/************************************************************************************
+* Service Name: Os_CoStartDelay
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Ticks - Length of the delay in Os ticks
+* Parameters (inout): Co - Coroutine starting the delay
+* Parameters (out): None
+* Return value: None
+* Description: Function to store the system counter value ending the delay.
+************************************************************************************/
+void Os_CoStartDelay(Os_CoroutineType * Co, TickType Ticks)
+{
+    TickType now = 0;
+
+    (void)GetCounterValue(OsConf_SYSTEM_COUNTER_ID, &now);
+    Co->Wake_Tick = now + Ticks;
+}
+
+/************************************************************************************
+* Service Name: Os_CoDelayElapsed
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Co - Coroutine in a delay
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE if the system counter reached the end of the delay
+* Description: Function to check the end of a delay, the counter may wrap around
+*              during the delay.
+************************************************************************************/
+boolean Os_CoDelayElapsed(const Os_CoroutineType * Co)
+{
+    TickType now = 0;
+
+    (void)GetCounterValue(OsConf_SYSTEM_COUNTER_ID, &now);
+    return ((TickType)(now - Co->Wake_Tick) < OS_CO_HALF_RANGE) ? TRUE : FALSE;
+}
+
+/************************************************************************************
+* Service Name: Os_CoEventsSet
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Mask - Events waited for
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE if one of the events is set for the running task
+* Description: Function to check the events of the task running the coroutine.
+************************************************************************************/
+boolean Os_CoEventsSet(EventMaskType Mask)
+{
+    TaskType task_id = OS_IDLE_TASK_ID;
+    EventMaskType events = 0;
+
+    (void)GetTaskID(&task_id);
+    (void)GetEvent(task_id, &events);
+    return ((events & Mask) != 0U) ? TRUE : FALSE;
+}
@@ -0,0 +1,122 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Coroutine.h
+ *
+ * Description: Header file for the Os stackless coroutines (protothreads).
+ *              A coroutine is a function of a task which can wait in the middle of a
+ *              sequence: at every wait it returns to the task and the next execution of
+ *              the task resumes it after the wait. Only the resume point is kept in an
+ *              Os_CoroutineType, so it needs no stack of its own and runs in the
+ *              cooperative scheduler:
+ *
+ *                  static Os_CoStatusType Sequence(Os_CoroutineType * Co)
+ *                  {
+ *                      OS_CO_BEGIN(Co);
+ *                      OS_CO_WAIT_UNTIL(Co, Condition() == TRUE);
+ *                      Step_1();
+ *                      OS_CO_DELAY(Co, 5U);
+ *                      Step_2();
+ *                      OS_CO_END(Co);
+ *                  }
+ *
+ *              Rules of the macros:
+ *              - The local variables of the coroutine are lost at every wait, the values
+ *                needed after a wait shall be static or in the caller.
+ *              - One wait per source line, the line number is the resume point.
+ *              - No switch statement around a wait.
+ *              - A wait is only checked again when the task runs: the task shall be periodic
+ *                or be activated again after the event it waits for.
+ *              No C++20 coroutine adapter is provided, the macros are for the C tasks only.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef OS_COROUTINE_H_
+#define OS_COROUTINE_H_
+
+#include "Os.h"
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for the status returned by a coroutine */
+typedef uint8 Os_CoStatusType;
+
+/* Status of a coroutine after one call */
+#define OS_CO_WAITING   (Os_CoStatusType)0x00   /* Waiting for a condition, a time or an event */
+#define OS_CO_YIELDED   (Os_CoStatusType)0x01   /* Gave the CPU back, continues at the next call */
+#define OS_CO_ENDED     (Os_CoStatusType)0x02   /* Reached OS_CO_END, the next call starts it again */
+
+/* State of one coroutine, a zero-initialized variable starts from OS_CO_BEGIN */
+typedef struct
+{
+    /* Resume point: the source line of the last wait, 0 to start from the beginning */
+    uint16 Line;
+    /* System counter value ending the running OS_CO_DELAY */
+    TickType Wake_Tick;
+} Os_CoroutineType;
+
+/*******************************************************************************
+ *                              Coroutine Macros                               *
+ *******************************************************************************/
+
+/* Start a coroutine again from OS_CO_BEGIN at its next call */
+#define OS_CO_INIT(CO)              ((CO)->Line = 0U)
+
+/* First statement of a coroutine: jump to the resume point, the code before a wait falls through to its case label */
+#define OS_CO_BEGIN(CO)             switch((CO)->Line) { case 0U:
+
+/* Last statement of a coroutine: the next call starts it again */
+#define OS_CO_END(CO)               } (CO)->Line = 0U; return OS_CO_ENDED
+
+/* Return to the task until the condition is TRUE, it is checked again at every call */
+#define OS_CO_WAIT_UNTIL(CO, COND)                              \
+    do                                                          \
+    {                                                           \
+        (CO)->Line = (uint16)__LINE__;                          \
+        FALLTHROUGH;                                            \
+        case __LINE__:                                          \
+        if(!(COND))                                             \
+        {                                                       \
+            return OS_CO_WAITING;                               \
+        }                                                       \
+    } while(0)
+
+/* Return to the task once, the coroutine continues after the yield at the next call */
+#define OS_CO_YIELD(CO)                                         \
+    do                                                          \
+    {                                                           \
+        (CO)->Line = (uint16)__LINE__;                          \
+        return OS_CO_YIELDED;                                   \
+        case __LINE__:                                          \
+        ;                                                       \
+    } while(0)
+
+/* Wait for TICKS ticks of the system counter (OS_BASE_TIME_US each), rounded up to the next task execution */
+#define OS_CO_DELAY(CO, TICKS)                                  \
+    do                                                          \
+    {                                                           \
+        Os_CoStartDelay((CO), (TICKS));                         \
+        OS_CO_WAIT_UNTIL((CO), Os_CoDelayElapsed(CO) == TRUE);  \
+    } while(0)
+
+/* Wait until one of the events in MASK is set for the running task, the events are not cleared */
+#define OS_CO_WAIT_EVENT(CO, MASK)  OS_CO_WAIT_UNTIL((CO), Os_CoEventsSet(MASK) == TRUE)
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Description: Set the end of a delay of Ticks ticks from now, used by OS_CO_DELAY */
+void Os_CoStartDelay(Os_CoroutineType * Co, TickType Ticks);
+
+/* Description: Return TRUE once the system counter reached the end of the delay, used by OS_CO_DELAY */
+boolean Os_CoDelayElapsed(const Os_CoroutineType * Co);
+
+/* Description: Return TRUE if one of the events in Mask is set for the running task, used by OS_CO_WAIT_EVENT */
+boolean Os_CoEventsSet(EventMaskType Mask);
+
+#endif /* OS_COROUTINE_H_ */
@@ -0,0 +1,78 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Jitter_Host.c
+ *
+ * Description: Source file for the export of the Os release jitter histograms - Linux host.
+ *              A host simulation run writes the histograms to a CSV file, one line per
+ *              task and bucket, so the jitter of two schedules can be compared:
+ *                  Task,Bucket_Start_Us,Bucket_End_Us,Count
+ *              The end of the last bucket is empty, it counts all the longer delays.
+ *              A second table gives the count and the longest delay of every task.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Os.h"
+
+#if defined(__linux__) && (OS_JITTER_HISTOGRAM == STD_ON)
+
+#include <stdio.h>
+
+/************************************************************************************
+* Service Name: Os_HostExportJitter
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): File_Name - Path of the CSV file to write
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK or E_NOT_OK if the file cannot be written
+* Description: Function to write the release jitter histograms of all the tasks
+*              followed by the summary of every task: Task,Count,Max_Latency_Us.
+************************************************************************************/
+Std_ReturnType Os_HostExportJitter(const char * File_Name)
+{
+    Std_ReturnType result = E_NOT_OK;
+    Os_JitterHistogramType histograms[OS_CONFIGURED_TASKS];
+    FILE * file = fopen(File_Name, "w");
+    TaskType task_id;
+    uint8 bucket;
+
+    if(file != NULL)
+    {
+	for(task_id = 0; task_id < OS_CONFIGURED_TASKS; task_id++)
+	{
+	    (void)Os_GetJitterHistogram(task_id, &histograms[task_id]);
+	}
+
+	fprintf(file, "Task,Bucket_Start_Us,Bucket_End_Us,Count\n");
+	for(task_id = 0; task_id < OS_CONFIGURED_TASKS; task_id++)
+	{
+	    for(bucket = 0; bucket < OS_JITTER_BUCKETS; bucket++)
+	    {
+		fprintf(file, "%u,%lu,", (unsigned)task_id, (unsigned long)bucket * OS_JITTER_BUCKET_WIDTH_US);
+		if(bucket < (OS_JITTER_BUCKETS - 1U))
+		{
+		    fprintf(file, "%lu", ((unsigned long)bucket + 1UL) * OS_JITTER_BUCKET_WIDTH_US);
+		}
+		fprintf(file, ",%lu\n", (unsigned long)histograms[task_id].Buckets[bucket]);
+	    }
+	}
+
+	fprintf(file, "\nTask,Count,Max_Latency_Us\n");
+	for(task_id = 0; task_id < OS_CONFIGURED_TASKS; task_id++)
+	{
+	    fprintf(file, "%u,%lu,%lu\n", (unsigned)task_id, (unsigned long)histograms[task_id].Count,
+		    (unsigned long)histograms[task_id].Max_Latency);
+	}
+
+	if(fclose(file) == 0)
+	{
+	    result = E_OK;
+	}
+    }
+    return result;
+}
+
+#endif /* defined(__linux__) && (OS_JITTER_HISTOGRAM == STD_ON) */
@@ -0,0 +1,149 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_PBcfg.c
+ *
+ * Description: Configuration Source file for Os Scheduler (task table and dispatch table).
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Os.h"
+#include "App.h"
+
+/* Every periodic task period shall divide the configured hyperperiod */
+#if !OS_PERIOD_DIVIDES_HYPERPERIOD(OsConf_BUTTON_TASK_PERIOD)\
+ || !OS_PERIOD_DIVIDES_HYPERPERIOD(OsConf_APP_TASK_PERIOD)\
+ || !OS_PERIOD_DIVIDES_HYPERPERIOD(OsConf_LED_TASK_PERIOD)
+  #error "A periodic task period does not divide OS_HYPERPERIOD_TICKS"
+#endif
+
+/* Every periodic task offset shall be inside its period */
+#if ((OsConf_BUTTON_TASK_PERIOD != OS_TASK_NOT_PERIODIC) && (OsConf_BUTTON_TASK_OFFSET >= OsConf_BUTTON_TASK_PERIOD))\
+ || ((OsConf_APP_TASK_PERIOD != OS_TASK_NOT_PERIODIC) && (OsConf_APP_TASK_OFFSET >= OsConf_APP_TASK_PERIOD))\
+ || ((OsConf_LED_TASK_PERIOD != OS_TASK_NOT_PERIODIC) && (OsConf_LED_TASK_OFFSET >= OsConf_LED_TASK_PERIOD))
+  #error "Os task offset must be less than the task period"
+#endif
+
+/* The task set and the set of the running schedule tables are stored in 32-bit masks */
+#if (OS_CONFIGURED_TASKS > 32U) || (OS_CONFIGURED_SCHEDULE_TABLES > 32U)
+  #error "The Os supports up to 32 tasks and 32 schedule tables"
+#endif
+
+/* The stacks which overflowed are stored in a 32-bit mask and the guard zone shall leave room in the task stacks */
+#if (OS_STACK_MONITOR == STD_ON) && ((OS_STACKS_COUNT > 32U) || ((OS_STACK_GUARD_WORDS * 4U) >= OS_TASK_STACK_SIZE))
+  #error "The stack monitoring supports up to 30 tasks and a guard zone smaller than OS_TASK_STACK_SIZE"
+#endif
+
+/* Set of the tasks released in one tick of the hyperperiod */
+#define OS_DISPATCH_MASK(TICK) \
+    ( (OS_TASK_RELEASED(TICK, OsConf_BUTTON_TASK_PERIOD, OsConf_BUTTON_TASK_OFFSET) << OsConf_BUTTON_TASK_ID_INDEX) \
+    | (OS_TASK_RELEASED(TICK, OsConf_APP_TASK_PERIOD,    OsConf_APP_TASK_OFFSET)    << OsConf_APP_TASK_ID_INDEX)    \
+    | (OS_TASK_RELEASED(TICK, OsConf_LED_TASK_PERIOD,    OsConf_LED_TASK_OFFSET)    << OsConf_LED_TASK_ID_INDEX) )
+
+/* Worst case execution time in microseconds of all the tasks released in one tick of the hyperperiod */
+#define OS_FRAME_LOAD(TICK) \
+    ( OS_TASK_FRAME_LOAD(TICK, OsConf_BUTTON_TASK_PERIOD, OsConf_BUTTON_TASK_OFFSET, OsConf_BUTTON_TASK_WCET) \
+    + OS_TASK_FRAME_LOAD(TICK, OsConf_APP_TASK_PERIOD,    OsConf_APP_TASK_OFFSET,    OsConf_APP_TASK_WCET)    \
+    + OS_TASK_FRAME_LOAD(TICK, OsConf_LED_TASK_PERIOD,    OsConf_LED_TASK_OFFSET,    OsConf_LED_TASK_WCET) )
+
+/*
+ * Dispatch table entry of one tick. The cooperative scheduler shall finish the tasks of every
+ * tick before the next tick, otherwise the tasks overrun: the entry of a tick whose tasks need
+ * more than OS_BASE_TIME_US has a negative array size and the table does not compile.
+ * Tools/Os_Analyzer.c reports the load of every tick and the worst case response time
+ * of every task, also for the preemptive kernel.
+ */
+#define OS_DISPATCH_ENTRY(TICK) \
+    (OS_DISPATCH_MASK(TICK) | (Os_TaskMaskType)(0U * sizeof(uint8[((OS_PREEMPTIVE == STD_ON) || (OS_FRAME_LOAD(TICK) <= OS_FRAME_TIME_US)) ? 1 : -1])))
+
+/* Entries of 2^n ticks from TICK */
+#define OS_DISPATCH_ROWS_1(TICK)     OS_DISPATCH_ENTRY(TICK),
+#define OS_DISPATCH_ROWS_2(TICK)     OS_DISPATCH_ROWS_1(TICK)   OS_DISPATCH_ROWS_1((TICK) + 1U)
+#define OS_DISPATCH_ROWS_4(TICK)     OS_DISPATCH_ROWS_2(TICK)   OS_DISPATCH_ROWS_2((TICK) + 2U)
+#define OS_DISPATCH_ROWS_8(TICK)     OS_DISPATCH_ROWS_4(TICK)   OS_DISPATCH_ROWS_4((TICK) + 4U)
+#define OS_DISPATCH_ROWS_16(TICK)    OS_DISPATCH_ROWS_8(TICK)   OS_DISPATCH_ROWS_8((TICK) + 8U)
+#define OS_DISPATCH_ROWS_32(TICK)    OS_DISPATCH_ROWS_16(TICK)  OS_DISPATCH_ROWS_16((TICK) + 16U)
+#define OS_DISPATCH_ROWS_64(TICK)    OS_DISPATCH_ROWS_32(TICK)  OS_DISPATCH_ROWS_32((TICK) + 32U)
+#define OS_DISPATCH_ROWS_128(TICK)   OS_DISPATCH_ROWS_64(TICK)  OS_DISPATCH_ROWS_64((TICK) + 64U)
+#define OS_DISPATCH_ROWS_256(TICK)   OS_DISPATCH_ROWS_128(TICK) OS_DISPATCH_ROWS_128((TICK) + 128U)
+#define OS_DISPATCH_ROWS_512(TICK)   OS_DISPATCH_ROWS_256(TICK) OS_DISPATCH_ROWS_256((TICK) + 256U)
+#define OS_DISPATCH_ROWS_1024(TICK)  OS_DISPATCH_ROWS_512(TICK) OS_DISPATCH_ROWS_512((TICK) + 512U)
+
+/* Task table, ordered by the task index */
+const Os_TaskConfigType Os_TaskConfiguration[OS_CONFIGURED_TASKS] =
+{
+    { Button_Task, OsConf_BUTTON_TASK_PERIOD, OsConf_BUTTON_TASK_OFFSET },
+    { App_Task,    OsConf_APP_TASK_PERIOD,    OsConf_APP_TASK_OFFSET    },
+    { Led_Task,    OsConf_LED_TASK_PERIOD,    OsConf_LED_TASK_OFFSET    }
+};
+
+/*
+ * Dispatch table computed by the compiler from the task periods and offsets, one entry per
+ * tick of the hyperperiod: every set bit of OS_HYPERPERIOD_TICKS adds a block of entries
+ * which starts after the blocks of the higher bits.
+ */
+const Os_TaskMaskType Os_DispatchTable[] =
+{
+#if ((OS_HYPERPERIOD_TICKS & 0x400U) != 0U)
+    OS_DISPATCH_ROWS_1024(0U)
+#endif
+#if ((OS_HYPERPERIOD_TICKS & 0x200U) != 0U)
+    OS_DISPATCH_ROWS_512(OS_HYPERPERIOD_TICKS & 0x400U)
+#endif
+#if ((OS_HYPERPERIOD_TICKS & 0x100U) != 0U)
+    OS_DISPATCH_ROWS_256(OS_HYPERPERIOD_TICKS & 0x600U)
+#endif
+#if ((OS_HYPERPERIOD_TICKS & 0x080U) != 0U)
+    OS_DISPATCH_ROWS_128(OS_HYPERPERIOD_TICKS & 0x700U)
+#endif
+#if ((OS_HYPERPERIOD_TICKS & 0x040U) != 0U)
+    OS_DISPATCH_ROWS_64(OS_HYPERPERIOD_TICKS & 0x780U)
+#endif
+#if ((OS_HYPERPERIOD_TICKS & 0x020U) != 0U)
+    OS_DISPATCH_ROWS_32(OS_HYPERPERIOD_TICKS & 0x7C0U)
+#endif
+#if ((OS_HYPERPERIOD_TICKS & 0x010U) != 0U)
+    OS_DISPATCH_ROWS_16(OS_HYPERPERIOD_TICKS & 0x7E0U)
+#endif
+#if ((OS_HYPERPERIOD_TICKS & 0x008U) != 0U)
+    OS_DISPATCH_ROWS_8(OS_HYPERPERIOD_TICKS & 0x7F0U)
+#endif
+#if ((OS_HYPERPERIOD_TICKS & 0x004U) != 0U)
+    OS_DISPATCH_ROWS_4(OS_HYPERPERIOD_TICKS & 0x7F8U)
+#endif
+#if ((OS_HYPERPERIOD_TICKS & 0x002U) != 0U)
+    OS_DISPATCH_ROWS_2(OS_HYPERPERIOD_TICKS & 0x7FCU)
+#endif
+#if ((OS_HYPERPERIOD_TICKS & 0x001U) != 0U)
+    OS_DISPATCH_ROWS_1(OS_HYPERPERIOD_TICKS & 0x7FEU)
+#endif
+};
+
+/* Compile time check that the dispatch table covers exactly one hyperperiod */
+typedef uint8 Os_DispatchTableSizeCheck[((sizeof(Os_DispatchTable) / sizeof(Os_DispatchTable[0])) == OS_HYPERPERIOD_TICKS) ? 1 : -1];
+
+/* Alarm table, ordered by the alarm index */
+const Os_AlarmConfigType Os_AlarmConfiguration[OS_CONFIGURED_ALARMS] =
+{
+    { OS_ALARM_ACTIVATETASK, OsConf_APP_TASK_ID_INDEX, 0U, NULL_PTR }
+};
+
+/* Expiry points of the application schedule table: the task is activated once per round */
+static const Os_ExpiryPointType Os_AppScheduleTablePoints[] =
+{
+    { 0U, OS_TASK_MASK(OsConf_APP_TASK_ID_INDEX) }
+};
+
+/* Schedule table table, ordered by the schedule table index */
+const Os_ScheduleTableConfigType Os_ScheduleTableConfiguration[OS_CONFIGURED_SCHEDULE_TABLES] =
+{
+    { Os_AppScheduleTablePoints, (uint8)(sizeof(Os_AppScheduleTablePoints) / sizeof(Os_AppScheduleTablePoints[0])), OsConf_APP_SCHEDULE_TABLE_DURATION, TRUE }
+};
+
+/* Resource table, ordered by the resource index */
+const Os_ResourceConfigType Os_ResourceConfiguration[OS_CONFIGURED_RESOURCES] =
+{
+    { OsConf_DIO_RESOURCE_USERS, TRUE }
+};
@@ -0,0 +1,230 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Port.c
+ *
+ * Description: Source file for the Os processor port - ARM Cortex-M4 (TM4C123GH6PM).
+ *              Tasks run in thread mode on the process stack (PSP), the context
+ *              switch is done in PendSV_Handler with the lowest interrupt priority.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Os_Port.h"
+
+#if !defined(__linux__)
+
+/* Trace enable bit (TRCENA) in the Debug Exception and Monitor Control register */
+#define DEMCR_TRCENA_BIT_POS        24
+
+/* Cycle counter enable bit (CYCCNTENA) in the DWT Control register */
+#define DWT_CYCCNTENA_BIT_POS       0
+
+/*********************************************************************************************/
+void Os_Port_InitTimestamp(void)
+{
+    /* Enable the DWT unit then start its cycle counter from 0 */
+    DEBUG_DEMCR_REG |= (1UL << DEMCR_TRCENA_BIT_POS);
+    DWT_CYCCNT_REG   = 0;
+    DWT_CTRL_REG    |= (1UL << DWT_CYCCNTENA_BIT_POS);
+}
+
+/*********************************************************************************************/
+boolean Os_Port_CompareAndSwap(volatile uint32 * Address, uint32 Expected, uint32 Desired)
+{
+    boolean stored = FALSE;
+    boolean done   = FALSE;
+
+    /* STREX fails if an interrupt ran since the LDREX (the exception clears the monitor), then retry */
+    while(done == FALSE)
+    {
+        if(__LDREX((unsigned long *)Address) != Expected)
+        {
+            __CLREX();
+            done = TRUE;
+        }
+        else if(__STREX(Desired, (unsigned long *)Address) == 0U)
+        {
+            stored = TRUE;
+            done   = TRUE;
+        }
+        else
+        {
+            /* Reservation lost ... try again */
+        }
+    }
+    return stored;
+}
+
+#if (OS_PREEMPTIVE == STD_ON)
+
+/* PendSV priority field in the System Handler Priority 3 register */
+#define PENDSV_PRIORITY_MASK        0xFF1FFFFF
+#define PENDSV_INTERRUPT_PRIORITY   7
+#define PENDSV_PRIORITY_BITS_POS    21
+
+/* PENDSVSET bit in the Interrupt Control and State register */
+#define PENDSV_SET_BIT_POS          28
+
+/* Initial xPSR of a task context ... only the Thumb bit is set */
+#define PORT_INITIAL_XPSR           0x01000000
+
+/* EXC_RETURN value to return to thread mode on the process stack without FPU context */
+#define PORT_EXC_RETURN_THREAD_PSP  0xFFFFFFFD
+
+/* Number of words in the stack of every context */
+#define PORT_STACK_WORDS            (OS_TASK_STACK_SIZE / 4U)
+
+/* Stacks of the task contexts, the last one is used by the idle context (8 bytes aligned as required by AAPCS) */
+#pragma data_alignment=8
+static uint32 g_Task_Stack[OS_CONFIGURED_TASKS + 1U][PORT_STACK_WORDS];
+
+/* Saved process stack pointer of every context */
+static uint32 * g_Task_Stack_Ptr[OS_CONFIGURED_TASKS + 1U];
+
+/* Context currently running on the process stack */
+static TaskType g_Port_Current_Task = OS_IDLE_TASK_ID;
+
+/* Description: Switch the thread mode to the process stack and jump to the idle entry */
+static __stackless void Os_Port_SwitchToProcessStack(uint32 * Stack_Top, void (*Entry)(void));
+
+/* Description: Save the stack pointer of the preempted context and return the one to resume */
+uint32 * Os_Port_SwitchStack(uint32 * Stack_Ptr);
+
+/*********************************************************************************************/
+void Os_Port_Init(void)
+{
+    /* Assign the lowest priority level to the PendSV Interrupt so it never preempts an ISR */
+    NVIC_SYSTEM_PRI3_REG = (NVIC_SYSTEM_PRI3_REG & PENDSV_PRIORITY_MASK) | (PENDSV_INTERRUPT_PRIORITY << PENDSV_PRIORITY_BITS_POS);
+}
+
+/*********************************************************************************************/
+void Os_Port_InitContext(TaskType Task_Id)
+{
+    uint32 * Stack_Ptr = &g_Task_Stack[Task_Id][PORT_STACK_WORDS];
+
+    /* Exception frame restored by the hardware on exception return */
+    *(--Stack_Ptr) = PORT_INITIAL_XPSR;                 /* xPSR */
+    *(--Stack_Ptr) = (uint32)Os_RunTask;                /* PC   */
+    *(--Stack_Ptr) = 0;                                 /* LR ... Os_RunTask never returns */
+    *(--Stack_Ptr) = 0;                                 /* R12  */
+    *(--Stack_Ptr) = 0;                                 /* R3   */
+    *(--Stack_Ptr) = 0;                                 /* R2   */
+    *(--Stack_Ptr) = 0;                                 /* R1   */
+    *(--Stack_Ptr) = (uint32)Task_Id;                   /* R0 = Os_RunTask argument */
+
+    /* Frame restored by PendSV_Handler: EXC_RETURN then R11 down to R4 */
+    *(--Stack_Ptr) = PORT_EXC_RETURN_THREAD_PSP;
+    Stack_Ptr -= 8;
+
+    g_Task_Stack_Ptr[Task_Id] = Stack_Ptr;
+}
+
+/*********************************************************************************************/
+void Os_Port_RequestSwitch(void)
+{
+    /* Pend the PendSV exception, it is taken once all the other interrupts are finished */
+    NVIC_INT_CTRL_REG = (1UL << PENDSV_SET_BIT_POS);
+}
+
+/*********************************************************************************************/
+void Os_Port_StartScheduler(void)
+{
+    g_Port_Current_Task = OS_IDLE_TASK_ID;
+    Os_Port_SwitchToProcessStack(&g_Task_Stack[OS_IDLE_TASK_ID][PORT_STACK_WORDS], Os_Scheduler);
+}
+
+/*********************************************************************************************/
+void Os_Port_Idle(void)
+{
+#if (OS_TICKLESS_IDLE == STD_ON)
+    /* Sleep until the next task release, the tick interrupt only fires when a task is released */
+    Os_Port_WaitForInterrupt();
+#endif
+}
+
+/*********************************************************************************************/
+static __stackless void Os_Port_SwitchToProcessStack(uint32 * Stack_Top, void (*Entry)(void))
+{
+    __asm volatile(
+        "MSR     PSP, R0        \n"     /* PSP = Stack_Top */
+        "MOVS    R0, #2         \n"
+        "MSR     CONTROL, R0    \n"     /* Thread mode uses the PSP */
+        "ISB                    \n"
+        "BX      R1             \n");   /* Jump to the idle entry, never returns */
+}
+
+/************************************************************************************
+* Service Name: Os_Port_SwitchStack
+* Description: Called from PendSV_Handler with the stack pointer of the preempted
+*              context, returns the stack pointer of the context to resume.
+************************************************************************************/
+uint32 * Os_Port_SwitchStack(uint32 * Stack_Ptr)
+{
+    g_Task_Stack_Ptr[g_Port_Current_Task] = Stack_Ptr;
+    g_Port_Current_Task = Os_ScheduleNext();
+    return g_Task_Stack_Ptr[g_Port_Current_Task];
+}
+
+/************************************************************************************
+* Service Name: PendSV_Handler
+* Description: PendSV ISR, saves R4-R11 (and S16-S31 if the FPU was used) of the
+*              preempted context on its stack and restores the selected one.
+************************************************************************************/
+__stackless void PendSV_Handler(void)
+{
+    __asm volatile(
+        "CPSID   I                      \n"
+        "MRS     R0, PSP                \n"
+        "TST     LR, #0x10              \n"     /* EXC_RETURN bit 4 is 0 if the FPU context is active */
+        "IT      EQ                     \n"
+        "VSTMDBEQ R0!, {S16-S31}        \n"
+        "STMDB   R0!, {R4-R11, LR}      \n"
+        "BL      Os_Port_SwitchStack    \n"
+        "LDMIA   R0!, {R4-R11, LR}      \n"
+        "TST     LR, #0x10              \n"
+        "IT      EQ                     \n"
+        "VLDMIAEQ R0!, {S16-S31}        \n"
+        "MSR     PSP, R0                \n"
+        "CPSIE   I                      \n"
+        "BX      LR                     \n");
+}
+
+#endif /* (OS_PREEMPTIVE == STD_ON) */
+
+#if (OS_STACK_MONITOR == STD_ON)
+
+/* Main stack placed by the linker configuration, its end is the initial SP of the vector table */
+#pragma section = "CSTACK"
+
+/*********************************************************************************************/
+boolean Os_Port_GetStackArea(uint8 Stack_Id, uint32 ** Bottom, uint32 * Words)
+{
+    boolean result = FALSE;
+
+    if(Stack_Id == OS_MAIN_STACK_ID)
+    {
+        *Bottom = (uint32 *)__section_begin("CSTACK");
+        *Words  = (uint32)__section_size("CSTACK") / 4U;
+        result  = TRUE;
+    }
+#if (OS_PREEMPTIVE == STD_ON)
+    else if(Stack_Id <= OS_IDLE_TASK_ID)
+    {
+        /* Task contexts and the idle context run on the process stack */
+        *Bottom = &g_Task_Stack[Stack_Id][0];
+        *Words  = PORT_STACK_WORDS;
+        result  = TRUE;
+    }
+#endif
+    else
+    {
+        /* No such stack */
+    }
+    return result;
+}
+
+#endif /* (OS_STACK_MONITOR == STD_ON) */
+
+#endif /* !defined(__linux__) */
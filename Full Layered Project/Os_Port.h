@@ -0,0 +1,166 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Port.h
+ *
+ * Description: Header file for the Os processor port (interrupt control, timestamps and context switching).
+ *              Os_Port.c implements the port for the ARM Cortex-M4 (TM4C123GH6PM),
+ *              Os_Port_Host.c implements it on Linux using ucontext for host builds.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef OS_PORT_H_
+#define OS_PORT_H_
+
+#include "Os.h"
+
+#if !defined(__linux__)
+#include <intrinsics.h>
+#include "tm4c123gh6pm_registers.h"
+#include "Mcu.h"
+#endif
+
+#if defined(__linux__)
+
+#include "Gpt.h"
+
+/* Host build ... there are no interrupts to mask, the tick is delivered by the host SysTick in the idle loop */
+#define Enable_Interrupts()
+#define Disable_Interrupts()
+
+/* Host build ... wait for the next host SysTick expiry (virtual or real time) and run its interrupt */
+#define Os_Port_WaitForInterrupt()   SysTick_WaitForInterrupt()
+
+/* Description: Read the free running timestamp counter (nanoseconds of CLOCK_MONOTONIC on the host) */
+uint32 Os_Port_GetTimestamp(void);
+
+/*
+ * Description: Read the timestamps from Source (nanoseconds) instead of CLOCK_MONOTONIC, NULL_PTR
+ *              goes back to CLOCK_MONOTONIC. A host test drives the measured times in virtual time with it.
+ */
+void Os_Port_HostSetTimestampSource(uint32 (*Source)(void));
+
+/* Frequency of the timestamp counter in Hz */
+#define OS_PORT_TIMESTAMP_HZ         (1000000000UL)
+
+/* Order the memory accesses before the barrier before the accesses after it (also a compiler barrier) */
+#define Os_Port_MemoryBarrier()      __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+/* Host build ... any non-zero value masks the emulated Os interrupts */
+#define OS_PORT_OS_INTERRUPTS_MASK   (1U)
+
+/*
+ * Description: Emulated PRIMASK (all interrupts) and BASEPRI (Os interrupts) registers.
+ *              A context switch requested while one of them is set is deferred until both
+ *              are cleared, as PendSV is masked on the target.
+ */
+uint32 Os_Port_GetAllInterruptsMask(void);
+void Os_Port_SetAllInterruptsMask(uint32 Mask);
+uint32 Os_Port_GetOsInterruptsMask(void);
+void Os_Port_SetOsInterruptsMask(uint32 Mask);
+
+/* Description: Return TRUE while an emulated interrupt runs (Os_Port_HostTick) */
+boolean Os_Port_InInterrupt(void);
+
+#else
+
+/* Enable IRQ Interrupts ... This Macro enables IRQ interrupts by clearing the I-bit in the PRIMASK. */
+#define Enable_Interrupts()    __asm("CPSIE I")
+
+/* Disable IRQ Interrupts ... This Macro disables IRQ interrupts by setting the I-bit in the PRIMASK. */
+#define Disable_Interrupts()   __asm("CPSID I")
+
+/* Sleep until the next interrupt ... also wakes up with the I-bit set, the interrupt is then taken after Enable_Interrupts() */
+#define Os_Port_WaitForInterrupt()   __asm("WFI")
+
+/* Read the free running timestamp counter ... the DWT cycle counter counts CPU cycles */
+#define Os_Port_GetTimestamp()       (DWT_CYCCNT_REG)
+
+/* Frequency of the timestamp counter in Hz ... the system clock of the Mcu Driver */
+#define OS_PORT_TIMESTAMP_HZ         MCU_CORE_CLOCK_HZ
+
+/* Order the memory accesses before the barrier before the accesses after it (also a compiler barrier) */
+#define Os_Port_MemoryBarrier()      __DMB()
+
+/* Number of the implemented interrupt priority bits, they are the upper bits of every 8-bit priority field */
+#define OS_PORT_PRIORITY_BITS        (3U)
+
+/* BASEPRI value masking the interrupts with the priority OS_ISR_PRIORITY_LIMIT and the lower priorities */
+#define OS_PORT_OS_INTERRUPTS_MASK   ((uint32)OS_ISR_PRIORITY_LIMIT << (8U - OS_PORT_PRIORITY_BITS))
+
+/* Read and write the I-bit in the PRIMASK ... 1 masks all the interrupts */
+#define Os_Port_GetAllInterruptsMask()       __get_PRIMASK()
+#define Os_Port_SetAllInterruptsMask(MASK)   __set_PRIMASK(MASK)
+
+/* Read and write the BASEPRI ... masks the interrupts with a priority value greater or equal, 0 masks none */
+#define Os_Port_GetOsInterruptsMask()        __get_BASEPRI()
+#define Os_Port_SetOsInterruptsMask(MASK)    __set_BASEPRI(MASK)
+
+/* TRUE while an exception handler runs ... the IPSR holds the active exception number, 0 in thread mode */
+#define Os_Port_InInterrupt()                ((__get_IPSR() != 0U) ? TRUE : FALSE)
+
+#endif
+
+/* Description: Start the free running timestamp counter */
+void Os_Port_InitTimestamp(void);
+
+/*
+ * Description: Store Desired in *Address if it still holds Expected, atomically against
+ *              interrupts without masking them (LDREX/STREX on the target).
+ *              Return TRUE if the value was stored.
+ */
+boolean Os_Port_CompareAndSwap(volatile uint32 * Address, uint32 Expected, uint32 Desired);
+
+#if (OS_STACK_MONITOR == STD_ON)
+/*
+ * Description: Get the lowest address and the size in words of a stack (see OS_MAIN_STACK_ID).
+ *              Return FALSE for a stack which is not used in this port and kernel mode.
+ */
+boolean Os_Port_GetStackArea(uint8 Stack_Id, uint32 ** Bottom, uint32 * Words);
+#endif
+
+#if (OS_PREEMPTIVE == STD_ON)
+
+/*******************************************************************************
+ *                 Port Services called by the Os kernel                       *
+ *******************************************************************************/
+
+/* Description: Configure the context switch interrupt (PendSV) with the lowest priority */
+void Os_Port_Init(void);
+
+/* Description: Prepare the context of a task to start from its entry point on its own stack */
+void Os_Port_InitContext(TaskType Task_Id);
+
+/* Description: Request a context switch, it is done once no interrupt is active */
+void Os_Port_RequestSwitch(void);
+
+/* Description: Move the caller to the idle context and run Os_Scheduler as the idle loop, never returns */
+void Os_Port_StartScheduler(void);
+
+/* Description: Called by the idle loop in every iteration while no task is ready */
+void Os_Port_Idle(void);
+
+/*******************************************************************************
+ *                 Kernel Services called by the port                          *
+ *******************************************************************************/
+
+/* Description: Select the highest priority ready task (or the idle context) to run next */
+TaskType Os_ScheduleNext(void);
+
+/* Description: Entry of every task context, runs the task then terminates it */
+void Os_RunTask(TaskType Task_Id);
+
+#if defined(__linux__)
+/*
+ * Description: Emulate one SysTick interrupt on the host: wait for the next host SysTick
+ *              expiry, its call back runs in interrupt context and the requested context
+ *              switch is done on exit.
+ */
+void Os_Port_HostTick(void);
+#endif
+
+#endif /* (OS_PREEMPTIVE == STD_ON) */
+
+#endif /* OS_PORT_H_ */
@@ -0,0 +1,242 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Port_Host.c
+ *
+ * Description: Source file for the Os processor port - Linux host (ucontext).
+ *              Every task context runs on its own stack inside one host thread.
+ *              The SysTick interrupt of the host Gpt backend is delivered by Os_Port_HostTick,
+ *              which may be called from the idle loop or from inside a task to model elapsed time.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Os_Port.h"
+
+#if defined(__linux__)
+
+#include <time.h>
+
+/* Emulated PRIMASK and BASEPRI registers */
+static uint32 g_All_Interrupts_Mask = 0;
+static uint32 g_Os_Interrupts_Mask = 0;
+
+/* Source of the timestamps set by Os_Port_HostSetTimestampSource, CLOCK_MONOTONIC if NULL_PTR */
+static uint32 (*g_Timestamp_Source)(void) = NULL_PTR;
+
+#if (OS_PREEMPTIVE == STD_ON)
+/* Take the context switch deferred while the interrupts were masked */
+static void Os_Port_HostUnmasked(void);
+#endif
+
+/*********************************************************************************************/
+void Os_Port_InitTimestamp(void)
+{
+    /* CLOCK_MONOTONIC is always running */
+}
+
+/*********************************************************************************************/
+uint32 Os_Port_GetTimestamp(void)
+{
+    struct timespec now;
+    uint32 result;
+
+    if(g_Timestamp_Source != NULL_PTR)
+    {
+        result = g_Timestamp_Source();
+    }
+    else
+    {
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        result = (uint32)(((uint64)now.tv_sec * 1000000000ULL) + (uint64)now.tv_nsec);
+    }
+    return result;
+}
+
+/*********************************************************************************************/
+void Os_Port_HostSetTimestampSource(uint32 (*Source)(void))
+{
+    g_Timestamp_Source = Source;
+}
+
+/*********************************************************************************************/
+boolean Os_Port_CompareAndSwap(volatile uint32 * Address, uint32 Expected, uint32 Desired)
+{
+    return __atomic_compare_exchange_n(Address, &Expected, Desired, FALSE, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) ? TRUE : FALSE;
+}
+
+/*********************************************************************************************/
+uint32 Os_Port_GetAllInterruptsMask(void)
+{
+    return g_All_Interrupts_Mask;
+}
+
+/*********************************************************************************************/
+void Os_Port_SetAllInterruptsMask(uint32 Mask)
+{
+    g_All_Interrupts_Mask = Mask;
+#if (OS_PREEMPTIVE == STD_ON)
+    Os_Port_HostUnmasked();
+#endif
+}
+
+/*********************************************************************************************/
+uint32 Os_Port_GetOsInterruptsMask(void)
+{
+    return g_Os_Interrupts_Mask;
+}
+
+/*********************************************************************************************/
+void Os_Port_SetOsInterruptsMask(uint32 Mask)
+{
+    g_Os_Interrupts_Mask = Mask;
+#if (OS_PREEMPTIVE == STD_ON)
+    Os_Port_HostUnmasked();
+#endif
+}
+
+#if (OS_PREEMPTIVE == STD_ON)
+
+#include <ucontext.h>
+
+/* Stack size in bytes of a task context on the host (the C library needs more than the target) */
+#define PORT_HOST_STACK_SIZE        (64U * 1024U)
+
+/* Contexts of the tasks, the last one is the idle context running on the main thread stack */
+static ucontext_t g_Task_Context[OS_CONFIGURED_TASKS + 1U];
+
+/* Stacks of the task contexts */
+static uint32 g_Task_Stack[OS_CONFIGURED_TASKS][PORT_HOST_STACK_SIZE / 4U];
+
+/* Context currently running */
+static TaskType g_Port_Current_Task = OS_IDLE_TASK_ID;
+
+/* Nesting level of the emulated interrupts, a context switch is deferred until it is 0 */
+static uint32 g_Isr_Nesting = 0;
+
+/* Set when a context switch was requested from an emulated interrupt */
+static boolean g_Switch_Pending = FALSE;
+
+/*********************************************************************************************/
+static void Os_Port_TaskStart(int Task_Id)
+{
+    Os_RunTask((TaskType)Task_Id);
+}
+
+/*********************************************************************************************/
+static void Os_Port_Switch(void)
+{
+    TaskType Previous_Task = g_Port_Current_Task;
+
+    g_Switch_Pending    = FALSE;
+    g_Port_Current_Task = Os_ScheduleNext();
+    if(g_Port_Current_Task != Previous_Task)
+    {
+        swapcontext(&g_Task_Context[Previous_Task], &g_Task_Context[g_Port_Current_Task]);
+    }
+}
+
+/*********************************************************************************************/
+void Os_Port_Init(void)
+{
+    g_Port_Current_Task = OS_IDLE_TASK_ID;
+    g_Isr_Nesting       = 0;
+    g_Switch_Pending    = FALSE;
+}
+
+/*********************************************************************************************/
+void Os_Port_InitContext(TaskType Task_Id)
+{
+    getcontext(&g_Task_Context[Task_Id]);
+    g_Task_Context[Task_Id].uc_stack.ss_sp   = g_Task_Stack[Task_Id];
+    g_Task_Context[Task_Id].uc_stack.ss_size = PORT_HOST_STACK_SIZE;
+    g_Task_Context[Task_Id].uc_link          = NULL_PTR;
+    makecontext(&g_Task_Context[Task_Id], (void (*)(void))Os_Port_TaskStart, 1, (int)Task_Id);
+}
+
+/*********************************************************************************************/
+void Os_Port_RequestSwitch(void)
+{
+    if((g_Isr_Nesting == 0U) && (g_All_Interrupts_Mask == 0U) && (g_Os_Interrupts_Mask == 0U))
+    {
+        Os_Port_Switch();
+    }
+    else
+    {
+        /* Same as PendSV: the switch is taken when the last interrupt returns and the interrupts are unmasked */
+        g_Switch_Pending = TRUE;
+    }
+}
+
+/*********************************************************************************************/
+static void Os_Port_HostUnmasked(void)
+{
+    if((g_Isr_Nesting == 0U) && (g_All_Interrupts_Mask == 0U) && (g_Os_Interrupts_Mask == 0U) && (g_Switch_Pending == TRUE))
+    {
+        Os_Port_Switch();
+    }
+}
+
+/*********************************************************************************************/
+void Os_Port_StartScheduler(void)
+{
+    /* The idle context is the calling host thread itself */
+    g_Port_Current_Task = OS_IDLE_TASK_ID;
+    Os_Scheduler();
+}
+
+/*********************************************************************************************/
+void Os_Port_Idle(void)
+{
+    /* Nothing else can happen while all tasks are idle ... wait for the next tick */
+    Os_Port_HostTick();
+}
+
+/*********************************************************************************************/
+void Os_Port_HostTick(void)
+{
+    g_Isr_Nesting++;
+    SysTick_WaitForInterrupt();
+    g_Isr_Nesting--;
+
+    Os_Port_HostUnmasked();
+}
+
+#endif /* (OS_PREEMPTIVE == STD_ON) */
+
+/*********************************************************************************************/
+boolean Os_Port_InInterrupt(void)
+{
+#if (OS_PREEMPTIVE == STD_ON)
+    return (g_Isr_Nesting != 0U) ? TRUE : FALSE;
+#else
+    /* The cooperative kernel delivers the host SysTick in the idle loop only, a task is never interrupted */
+    return FALSE;
+#endif
+}
+
+#if (OS_STACK_MONITOR == STD_ON)
+/*********************************************************************************************/
+boolean Os_Port_GetStackArea(uint8 Stack_Id, uint32 ** Bottom, uint32 * Words)
+{
+    boolean result = FALSE;
+
+#if (OS_PREEMPTIVE == STD_ON)
+    /* Only the task contexts have their own stack, the idle context and the interrupts run on the host thread stack */
+    if(Stack_Id < OS_CONFIGURED_TASKS)
+    {
+        *Bottom = &g_Task_Stack[Stack_Id][0];
+        *Words  = PORT_HOST_STACK_SIZE / 4U;
+        result  = TRUE;
+    }
+#else
+    (void)Stack_Id;
+    (void)Bottom;
+    (void)Words;
+#endif
+    return result;
+}
+#endif /* (OS_STACK_MONITOR == STD_ON) */
+
+#endif /* defined(__linux__) */
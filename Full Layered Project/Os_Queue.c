@@ -0,0 +1,195 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Queue.c
+ *
+ * Description: Source file for the Os deferred work queues.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Os_Queue.h"
+#include "Os_Port.h"
+
+/************************************************************************************
+* Service Name: Os_SpscQueueInit
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Buffer - Storage of the items
+*                  Size   - Number of the items in the buffer, a power of 2
+* Parameters (inout): Queue - Queue to initialize
+* Parameters (out): None
+* Return value: None
+* Description: Function to initialize an empty single producer queue.
+************************************************************************************/
+void Os_SpscQueueInit(Os_SpscQueueType * Queue, Os_WorkItemType * Buffer, uint32 Size)
+{
+    Queue->Buffer = Buffer;
+    Queue->Size   = Size;
+    Queue->Head   = 0;
+    Queue->Tail   = 0;
+}
+
+/************************************************************************************
+* Service Name: Os_SpscQueuePost
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant (one producer)
+* Parameters (in): Item - Work item to copy in the queue
+* Parameters (inout): Queue - Queue to post to
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK or E_NOT_OK if the queue is full
+* Description: Function to post a work item, the item is visible to the consumer only
+*              after it is completely written.
+************************************************************************************/
+Std_ReturnType Os_SpscQueuePost(Os_SpscQueueType * Queue, const Os_WorkItemType * Item)
+{
+    Std_ReturnType result = E_NOT_OK;
+    uint32 head = Queue->Head;
+
+    if((head - Queue->Tail) < Queue->Size)
+    {
+        Queue->Buffer[head & (Queue->Size - 1U)] = *Item;
+
+        /* Publish the index after the item */
+        Os_Port_MemoryBarrier();
+        Queue->Head = head + 1U;
+        result = E_OK;
+    }
+    return result;
+}
+
+/************************************************************************************
+* Service Name: Os_SpscQueueGet
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant (one consumer)
+* Parameters (in): None
+* Parameters (inout): Queue - Queue to read from
+* Parameters (out): Item - Oldest work item
+* Return value: Std_ReturnType - E_OK or E_NOT_OK if the queue is empty
+* Description: Function to take the oldest work item from the queue.
+************************************************************************************/
+Std_ReturnType Os_SpscQueueGet(Os_SpscQueueType * Queue, Os_WorkItemType * Item)
+{
+    Std_ReturnType result = E_NOT_OK;
+    uint32 tail = Queue->Tail;
+
+    if(tail != Queue->Head)
+    {
+        /* Read the item only after seeing the index published by the producer */
+        Os_Port_MemoryBarrier();
+        *Item = Queue->Buffer[tail & (Queue->Size - 1U)];
+
+        /* Free the slot after the item is copied */
+        Os_Port_MemoryBarrier();
+        Queue->Tail = tail + 1U;
+        result = E_OK;
+    }
+    return result;
+}
+
+/************************************************************************************
+* Service Name: Os_MpscQueueInit
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Slots - Storage of the slots
+*                  Size  - Number of the slots, a power of 2
+* Parameters (inout): Queue - Queue to initialize
+* Parameters (out): None
+* Return value: None
+* Description: Function to initialize an empty multi producer queue, the sequence of
+*              every slot is the producer index which may use it next.
+************************************************************************************/
+void Os_MpscQueueInit(Os_MpscQueueType * Queue, Os_MpscSlotType * Slots, uint32 Size)
+{
+    uint32 index;
+
+    for(index = 0; index < Size; index++)
+    {
+        Slots[index].Sequence = index;
+    }
+    Queue->Slots = Slots;
+    Queue->Size  = Size;
+    Queue->Head  = 0;
+    Queue->Tail  = 0;
+}
+
+/************************************************************************************
+* Service Name: Os_MpscQueuePost
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Item - Work item to copy in the queue
+* Parameters (inout): Queue - Queue to post to
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK or E_NOT_OK if the queue is full
+* Description: Function to post a work item from any ISR or task. The slot is reserved
+*              with a compare and swap on the head index, so a producer interrupted by
+*              another producer never blocks it: the interrupting one takes the next slot.
+************************************************************************************/
+Std_ReturnType Os_MpscQueuePost(Os_MpscQueueType * Queue, const Os_WorkItemType * Item)
+{
+    Std_ReturnType result = E_NOT_OK;
+    boolean done = FALSE;
+    Os_MpscSlotType * slot;
+    uint32 head;
+
+    while(done == FALSE)
+    {
+        head = Queue->Head;
+        slot = &Queue->Slots[head & (Queue->Size - 1U)];
+
+        if((sint32)(slot->Sequence - head) < 0)
+        {
+            /* The slot still holds the item posted one round before ... the queue is full */
+            done = TRUE;
+        }
+        else if((slot->Sequence == head) && (Os_Port_CompareAndSwap(&Queue->Head, head, head + 1U) == TRUE))
+        {
+            slot->Item = *Item;
+
+            /* Hand the slot to the consumer after the item */
+            Os_Port_MemoryBarrier();
+            slot->Sequence = head + 1U;
+            result = E_OK;
+            done   = TRUE;
+        }
+        else
+        {
+            /* Another producer took the slot meanwhile ... read the head again and try the next one */
+        }
+    }
+    return result;
+}
+
+/************************************************************************************
+* Service Name: Os_MpscQueueGet
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant (one consumer)
+* Parameters (in): None
+* Parameters (inout): Queue - Queue to read from
+* Parameters (out): Item - Oldest work item
+* Return value: Std_ReturnType - E_OK or E_NOT_OK if the queue is empty
+* Description: Function to take the oldest work item from the queue. A slot reserved
+*              by a producer which is still writing it reads as empty, the item is
+*              available once the producer (an interrupted ISR) resumes and ends.
+************************************************************************************/
+Std_ReturnType Os_MpscQueueGet(Os_MpscQueueType * Queue, Os_WorkItemType * Item)
+{
+    Std_ReturnType result = E_NOT_OK;
+    uint32 tail = Queue->Tail;
+    Os_MpscSlotType * slot = &Queue->Slots[tail & (Queue->Size - 1U)];
+
+    if(slot->Sequence == (tail + 1U))
+    {
+        /* Read the item only after seeing the sequence published by the producer */
+        Os_Port_MemoryBarrier();
+        *Item = slot->Item;
+
+        /* Free the slot for the producers of the next round after the item is copied */
+        Os_Port_MemoryBarrier();
+        slot->Sequence = tail + Queue->Size;
+        Queue->Tail    = tail + 1U;
+        result = E_OK;
+    }
+    return result;
+}
@@ -0,0 +1,90 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Queue.h
+ *
+ * Description: Header file for the Os deferred work queues.
+ *              Lock-free ring buffers to post small work items from ISRs to task
+ *              context without masking the interrupts:
+ *              - Os_SpscQueue: one producer (one ISR) and one consumer (one task).
+ *              - Os_MpscQueue: any number of producers (nested ISRs of different
+ *                priorities or tasks) and one consumer, slots are reserved with
+ *                LDREX/STREX through Os_Port_CompareAndSwap.
+ *              The consumer task is usually activated or woken up by the producer
+ *              with ActivateTask or SetEvent after a successful post.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef OS_QUEUE_H_
+#define OS_QUEUE_H_
+
+#include "Std_Types.h"
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Work item executed at task level: Work_Ptr(Data) */
+typedef struct
+{
+    void (*Work_Ptr)(uint32 Data);
+    uint32 Data;
+} Os_WorkItemType;
+
+/* Single producer / single consumer queue */
+typedef struct
+{
+    /* Storage of Size items, Size shall be a power of 2 */
+    Os_WorkItemType * Buffer;
+    uint32 Size;
+    /* Free running indexes: Head is written by the producer only, Tail by the consumer only */
+    volatile uint32 Head;
+    volatile uint32 Tail;
+} Os_SpscQueueType;
+
+/* One slot of a multi producer queue, the sequence tells if the slot is free or holds an item */
+typedef struct
+{
+    volatile uint32 Sequence;
+    Os_WorkItemType Item;
+} Os_MpscSlotType;
+
+/* Multi producer / single consumer queue */
+typedef struct
+{
+    /* Storage of Size slots, Size shall be a power of 2 */
+    Os_MpscSlotType * Slots;
+    uint32 Size;
+    /* Next slot reserved by a producer (compare and swap) and next slot read by the consumer */
+    volatile uint32 Head;
+    volatile uint32 Tail;
+} Os_MpscQueueType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Description: Initialize an empty single producer queue on a buffer of Size items (a power of 2) */
+void Os_SpscQueueInit(Os_SpscQueueType * Queue, Os_WorkItemType * Buffer, uint32 Size);
+
+/* Description: Post a work item from the producer, return E_NOT_OK if the queue is full */
+Std_ReturnType Os_SpscQueuePost(Os_SpscQueueType * Queue, const Os_WorkItemType * Item);
+
+/* Description: Take the oldest work item in the consumer, return E_NOT_OK if the queue is empty */
+Std_ReturnType Os_SpscQueueGet(Os_SpscQueueType * Queue, Os_WorkItemType * Item);
+
+/* Description: Initialize an empty multi producer queue on Size slots (a power of 2) */
+void Os_MpscQueueInit(Os_MpscQueueType * Queue, Os_MpscSlotType * Slots, uint32 Size);
+
+/* Description: Post a work item from any producer, return E_NOT_OK if the queue is full */
+Std_ReturnType Os_MpscQueuePost(Os_MpscQueueType * Queue, const Os_WorkItemType * Item);
+
+/*
+ * Description: Take the oldest work item in the consumer, return E_NOT_OK if the queue is empty
+ *              or the oldest slot is still being written by an interrupted producer.
+ */
+Std_ReturnType Os_MpscQueueGet(Os_MpscQueueType * Queue, Os_WorkItemType * Item);
+
+#endif /* OS_QUEUE_H_ */
@@ -0,0 +1,97 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Trace.c
+ *
+ * Description: Source file for the Os binary event trace.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Os_Trace.h"
+
+#if (OS_TRACE == STD_ON)
+
+#include "Os_Port.h"
+
+#if defined(__linux__)
+#include <stdio.h>
+#endif
+
+#if ((OS_TRACE_RECORDS & (OS_TRACE_RECORDS - 1U)) != 0U)
+#error "OS_TRACE_RECORDS shall be a power of 2"
+#endif
+
+/* Trace ring buffer, the header tells the decoder how to read a memory dump */
+Os_TraceBufferType Os_TraceBuffer =
+{
+    OS_TRACE_MAGIC,
+    OS_PORT_TIMESTAMP_HZ,
+    OS_TRACE_RECORDS,
+    0U,
+    { { 0U, 0U, 0U, 0U } }
+};
+
+/************************************************************************************
+* Service Name: Os_TraceRecord
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Event - OS_TRACE_xxx event
+*                  Id    - Task, interrupt, channel or module of the event
+*                  Data  - Value of the event
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to write one record in the trace ring buffer. All the interrupts
+*              are masked for the few instructions taking the slot, the timestamp and
+*              writing the record, so the records are in timestamp order even when an
+*              interrupt records its own events meanwhile.
+************************************************************************************/
+void Os_TraceRecord(uint8 Event, uint8 Id, uint16 Data)
+{
+    uint32 mask = Os_Port_GetAllInterruptsMask();
+    Os_TraceRecordType * record;
+
+    Os_Port_SetAllInterruptsMask(1U);
+    record = &Os_TraceBuffer.Records[Os_TraceBuffer.Index & (OS_TRACE_RECORDS - 1U)];
+    record->Timestamp = Os_Port_GetTimestamp();
+    record->Event     = Event;
+    record->Id        = Id;
+    record->Data      = Data;
+    Os_TraceBuffer.Index++;
+    Os_Port_SetAllInterruptsMask(mask);
+}
+
+#if defined(__linux__)
+/************************************************************************************
+* Service Name: Os_HostExportTrace
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): File_Name - Path of the binary file to write
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK or E_NOT_OK if the file cannot be written
+* Description: Function to write the trace buffer as a memory dump of Os_TraceBuffer.
+************************************************************************************/
+Std_ReturnType Os_HostExportTrace(const char * File_Name)
+{
+    Std_ReturnType result = E_NOT_OK;
+    FILE * file = fopen(File_Name, "wb");
+
+    if(file != NULL)
+    {
+        if(fwrite(&Os_TraceBuffer, sizeof(Os_TraceBuffer), 1U, file) == 1U)
+        {
+            result = E_OK;
+        }
+        if(fclose(file) != 0)
+        {
+            result = E_NOT_OK;
+        }
+    }
+    return result;
+}
+#endif /* defined(__linux__) */
+
+#endif /* (OS_TRACE == STD_ON) */
@@ -0,0 +1,98 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Trace.h
+ *
+ * Description: Header file for the Os binary event trace.
+ *              Every event is an 8-byte record written in a ring buffer in RAM, the
+ *              newest records overwrite the oldest ones. The buffer (Os_TraceBuffer)
+ *              is dumped from the debugger, or written to a file by a host simulation
+ *              run, then converted to the Chrome trace / Perfetto JSON format by
+ *              Tools/Os_TraceDecoder.c.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef OS_TRACE_H_
+#define OS_TRACE_H_
+
+#include "Std_Types.h"
+
+/* Os Pre-Compile Configuration Header file */
+#include "Os_Cfg.h"
+
+/* First word of the trace buffer, "OSTR" in memory */
+#define OS_TRACE_MAGIC          (0x5254534FUL)
+
+/* Trace events, the meaning of the Id and Data fields follows every event */
+#define OS_TRACE_TASK_BEGIN     (1U)    /* Id: task index */
+#define OS_TRACE_TASK_END       (2U)    /* Id: task index */
+#define OS_TRACE_ISR_ENTER      (3U)    /* Id: OS_TRACE_ISR_xxx */
+#define OS_TRACE_ISR_EXIT       (4U)    /* Id: OS_TRACE_ISR_xxx */
+#define OS_TRACE_DIO_WRITE      (5U)    /* Id: channel, Data: level written */
+#define OS_TRACE_DIO_FLIP       (6U)    /* Id: channel, Data: level after the flip */
+#define OS_TRACE_DET_REPORT     (7U)    /* Id: module, Data: (service << 8) | error */
+
+/* Interrupts traced by the ISR events */
+#define OS_TRACE_ISR_SYSTICK    (0U)
+#define OS_TRACE_ISR_GPT(TIMER) (1U + (TIMER))     /* Timer A of a Gpt timer, GPT_TIMER_0 to GPT_WTIMER_5 */
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* One trace record */
+typedef struct
+{
+    /* Os_Port_GetTimestamp at the event (CPU cycles on the target, nanoseconds on the host) */
+    uint32 Timestamp;
+    uint8 Event;
+    uint8 Id;
+    uint16 Data;
+} Os_TraceRecordType;
+
+/* Trace ring buffer, the layout read by the decoder from a memory dump */
+typedef struct
+{
+    /* OS_TRACE_MAGIC */
+    uint32 Magic;
+    /* Frequency of the timestamp counter in Hz */
+    uint32 Timestamp_Hz;
+    /* Number of the records in the ring, a power of 2 */
+    uint32 Records_Count;
+    /* Number of the records written since the start, the next record is Records[Index % Records_Count] */
+    volatile uint32 Index;
+    Os_TraceRecordType Records[OS_TRACE_RECORDS];
+} Os_TraceBufferType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+#if (OS_TRACE == STD_ON)
+
+/* Record an event, the trace points use OS_TRACE_EVENT so they are removed with OS_TRACE off */
+#define OS_TRACE_EVENT(EVENT, ID, DATA)     Os_TraceRecord((EVENT), (uint8)(ID), (uint16)(DATA))
+
+/* Description: Write one record in the trace ring buffer, callable from tasks and ISRs */
+void Os_TraceRecord(uint8 Event, uint8 Id, uint16 Data);
+
+#if defined(__linux__)
+/*
+ * Description: Write the trace buffer to a file at the end of a host simulation run,
+ *              in the same layout as a memory dump. Return E_NOT_OK if the file cannot be written.
+ */
+Std_ReturnType Os_HostExportTrace(const char * File_Name);
+#endif
+
+/* Trace ring buffer, dump sizeof(Os_TraceBuffer) bytes from its address */
+extern Os_TraceBufferType Os_TraceBuffer;
+
+#else
+
+#define OS_TRACE_EVENT(EVENT, ID, DATA)
+
+#endif /* (OS_TRACE == STD_ON) */
+
+#endif /* OS_TRACE_H_ */
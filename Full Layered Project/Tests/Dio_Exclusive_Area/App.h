@@ -0,0 +1,26 @@
+ /******************************************************************************
+ *
+ * Module: application
+ *
+ * File Name: App.h
+ *
+ * Description: Header file for the Tasks of the Dio exclusive area test.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef APP_H_
+#define APP_H_
+
+#include "Std_Types.h"
+
+/* Description: Task executes once to initialize the Dio Driver and activate the Holder task */
+void Init_Task(void);
+
+/* Description: Task holds the Dio resource while an interrupt writes a Dio channel */
+void Holder_Task(void);
+
+/* Description: Task flips the Dio channel once the Holder releases the resource */
+void Writer_Task(void);
+
+#endif /* APP_H_ */
@@ -0,0 +1,124 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Dio_Exclusive_Area.c
+ *
+ * Description: Host test of the Dio exclusive area with the preemptive kernel. The Holder task
+ *              takes the Dio resource, then an emulated SysTick interrupt (Os_Port_HostTick)
+ *              writes LED1 with Dio_WriteChannel:
+ *              - At interrupt level the resource services return E_OS_CALLEVEL, the interrupt
+ *                locks the Os interrupts instead and never releases the resource of the Holder.
+ *              - The resource shared with the interrupts keeps the Os interrupts masked until
+ *                ReleaseResource, the higher priority Writer task user stays out by the ceiling.
+ *              - After ReleaseResource the Writer preempts the Holder and flips LED1 back.
+ *              The port registers (0x40000000, 1MB) are plain memory mapped before main.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Os.h"
+#include "Os_Port.h"
+#include "Gpt.h"
+#include "Dio.h"
+#include "Dio_Regs.h"
+#include "Common_Macros.h"
+#include "App.h"
+#include "Host_Test.h"
+
+#include <sys/mman.h>
+
+/* Peripheral region of the Dio port data registers */
+#define TEST_PERIPHERALS_ADDRESS    (0x40000000UL)
+#define TEST_PERIPHERALS_SIZE       (0x00100000UL)
+
+/* Set by the Holder for the next interrupt to write LED1, cleared by the interrupt */
+static volatile boolean g_Isr_Write = FALSE;
+static volatile boolean g_Isr_Wrote = FALSE;
+
+/* Set once the Writer task ran */
+static volatile boolean g_Writer_Ran = FALSE;
+
+/*********************************************************************************************/
+/* Description: SysTick subscriber, the interrupt writing LED1 when the Holder asks for it */
+static void Isr_Write(void)
+{
+    if(g_Isr_Write == TRUE)
+    {
+        g_Isr_Write = FALSE;
+
+        /* An interrupt is not a task: it can neither take nor release the resource of the Holder */
+        HOST_TEST_CHECK(E_OS_CALLEVEL == GetResource(OsConf_DIO_RESOURCE_ID_INDEX));
+        HOST_TEST_CHECK(E_OS_CALLEVEL == ReleaseResource(OsConf_DIO_RESOURCE_ID_INDEX));
+
+        Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_HIGH);
+        g_Isr_Wrote = TRUE;
+    }
+}
+
+/*********************************************************************************************/
+void Init_Task(void)
+{
+    Dio_Init(&Dio_Configuration);
+
+    /* Before the scheduler runs the exclusive area masks the Os interrupts, the write restores the mask */
+    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_LOW);
+    HOST_TEST_CHECK(0U == Os_Port_GetOsInterruptsMask());
+
+    (void)ActivateTask(OsConf_HOLDER_TASK_ID_INDEX);
+}
+
+/*********************************************************************************************/
+void Holder_Task(void)
+{
+    HOST_TEST_CHECK(E_OK == GetResource(OsConf_DIO_RESOURCE_ID_INDEX));
+    HOST_TEST_CHECK(0U != Os_Port_GetOsInterruptsMask());
+
+    /* The Writer is a user of the resource: the ceiling keeps it out */
+    (void)ActivateTask(OsConf_WRITER_TASK_ID_INDEX);
+    HOST_TEST_CHECK(FALSE == g_Writer_Ran);
+
+    /* On the target the masked interrupt would wait for ReleaseResource, the host delivers it now */
+    g_Isr_Write = TRUE;
+    Os_Port_HostTick();
+    HOST_TEST_CHECK(TRUE == g_Isr_Wrote);
+    HOST_TEST_CHECK(BIT_IS_SET(GPIO_PORTF_DATA_REG, DioConf_LED1_CHANNEL_NUM));
+
+    /* The resource is still held by the Holder after the interrupt */
+    HOST_TEST_CHECK(FALSE == g_Writer_Ran);
+    HOST_TEST_CHECK(0U != Os_Port_GetOsInterruptsMask());
+
+    /* The Writer preempts the Holder at the release */
+    HOST_TEST_CHECK(E_OK == ReleaseResource(OsConf_DIO_RESOURCE_ID_INDEX));
+    HOST_TEST_CHECK(TRUE == g_Writer_Ran);
+    HOST_TEST_CHECK(0U == Os_Port_GetOsInterruptsMask());
+    HOST_TEST_CHECK(BIT_IS_CLEAR(GPIO_PORTF_DATA_REG, DioConf_LED1_CHANNEL_NUM));
+
+    HOST_TEST_END();
+}
+
+/*********************************************************************************************/
+void Writer_Task(void)
+{
+    g_Writer_Ran = TRUE;
+    HOST_TEST_CHECK(STD_LOW == Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX));
+}
+
+/*********************************************************************************************/
+int main(void)
+{
+    void * peripherals;
+
+    peripherals = mmap((void *)TEST_PERIPHERALS_ADDRESS, TEST_PERIPHERALS_SIZE, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    HOST_TEST_CHECK(peripherals == (void *)TEST_PERIPHERALS_ADDRESS);
+    if(peripherals != (void *)TEST_PERIPHERALS_ADDRESS)
+    {
+        HOST_TEST_END();
+    }
+
+    SysTick_HostSetMode(SYSTICK_HOST_VIRTUAL_TIME);
+    HOST_TEST_CHECK(E_OK == SysTick_Subscribe(Isr_Write, 1U));
+    Os_start();
+    return 0;
+}
@@ -0,0 +1,49 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_PBcfg.c
+ *
+ * Description: Configuration Source file for Os Scheduler - Dio exclusive area.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Os.h"
+#include "App.h"
+
+/* Task table, ordered by the task index */
+const Os_TaskConfigType Os_TaskConfiguration[OS_CONFIGURED_TASKS] =
+{
+    { Writer_Task, OsConf_WRITER_TASK_PERIOD, 0U },
+    { Holder_Task, OsConf_HOLDER_TASK_PERIOD, 0U }
+};
+
+/* No task is released by the tick */
+const Os_TaskMaskType Os_DispatchTable[OS_HYPERPERIOD_TICKS] =
+{
+    0U
+};
+
+/* Unused alarm */
+const Os_AlarmConfigType Os_AlarmConfiguration[OS_CONFIGURED_ALARMS] =
+{
+    { OS_ALARM_ACTIVATETASK, OsConf_HOLDER_TASK_ID_INDEX, 0U, NULL_PTR }
+};
+
+/* Unused schedule table */
+static const Os_ExpiryPointType Os_UnusedScheduleTablePoints[] =
+{
+    { 0U, 0U }
+};
+
+const Os_ScheduleTableConfigType Os_ScheduleTableConfiguration[OS_CONFIGURED_SCHEDULE_TABLES] =
+{
+    { Os_UnusedScheduleTablePoints, 1U, 1U, FALSE }
+};
+
+/* Dio resource, an interrupt may write a Dio channel */
+const Os_ResourceConfigType Os_ResourceConfiguration[OS_CONFIGURED_RESOURCES] =
+{
+    { OsConf_DIO_RESOURCE_USERS, TRUE }
+};
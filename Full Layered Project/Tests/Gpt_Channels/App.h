@@ -0,0 +1,23 @@
+ /******************************************************************************
+ *
+ * Module: application
+ *
+ * File Name: App.h
+ *
+ * Description: Header file for the Gpt notifications of the Gpt channels test.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef APP_H_
+#define APP_H_
+
+#include "Std_Types.h"
+
+/* Description: Notification of the continuous channel */
+void Periodic_Notification(void);
+
+/* Description: Notification of the one-shot channel */
+void Timeout_Notification(void);
+
+#endif /* APP_H_ */
@@ -0,0 +1,98 @@
+ /******************************************************************************
+ *
+ * Module: Gpt
+ *
+ * File Name: Gpt_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - Gpt Driver
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef GPT_CFG_H
+#define GPT_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define GPT_CFG_SW_MAJOR_VERSION              (1U)
+#define GPT_CFG_SW_MINOR_VERSION              (0U)
+#define GPT_CFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define GPT_CFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define GPT_CFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define GPT_CFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* Pre-compile option for Development Error Detect */
+#define GPT_DEV_ERROR_DETECT                (STD_ON)
+
+/* Pre-compile option for Version Info API */
+#define GPT_VERSION_INFO_API                (STD_OFF)
+
+/* Pre-compile option for presence of Gpt_DeInit API */
+#define GPT_DEINIT_API                      (STD_ON)
+
+/* Pre-compile option for presence of Gpt_GetTimeElapsed API */
+#define GPT_TIME_ELAPSED_API                (STD_ON)
+
+/* Pre-compile option for presence of Gpt_GetTimeRemaining API */
+#define GPT_TIME_REMAINING_API              (STD_ON)
+
+/* Pre-compile option for presence of Gpt_EnableNotification and Gpt_DisableNotification APIs */
+#define GPT_ENABLE_DISABLE_NOTIFICATION_API (STD_ON)
+
+/*
+ * Pre-compile option for presence of the predefined timers (Gpt_GetPredefTimerValue and
+ * Gpt_GetPredefTimerValue64): a wide timer counts the system clock in 64-bit mode from
+ * Gpt_Init, it never wraps around in practice.
+ */
+#define GPT_PREDEF_TIMER_API                (STD_ON)
+
+/* Wide timer of the predefined timers, it shall not be used by a configured channel */
+#define GPT_PREDEF_TIMER_WTIMER             GPT_WTIMER_5
+
+/* Frequency of the channel and predefined timer ticks in Hz, the timers count the system clock without prescaler */
+#define GPT_TICK_FREQUENCY                  MCU_CORE_CLOCK_HZ
+
+/* Number of the SysTick subscribers registered by SysTick_Subscribe, the Os tick is one of them */
+#define SYSTICK_MAX_SUBSCRIBERS             (4U)
+
+/* Pre-compile option for the measurement of the worst case SysTick interrupt duration (SysTick_GetMaxIsrTime) */
+#define SYSTICK_ISR_STATS                   (STD_OFF)
+
+/* Number of the configured Gpt Channels */
+#define GPT_CONFIGURED_CHANNELS             (2U)
+
+/* Channel Index in the array of structures in Gpt_PBcfg.c */
+#define GptConf_PERIODIC_CHANNEL_ID_INDEX   (Gpt_ChannelType)0x00
+#define GptConf_TIMEOUT_CHANNEL_ID_INDEX    (Gpt_ChannelType)0x01
+
+/* Gpt Configured Timers */
+#define GptConf_PERIODIC_CHANNEL_TIMER      GPT_TIMER_0
+#define GptConf_TIMEOUT_CHANNEL_TIMER       GPT_WTIMER_1
+
+/*
+ * Gpt Configured Interrupt priorities (0 is the highest, 7 the lowest).
+ * A notification calling the Os services shall not be above OS_ISR_PRIORITY_LIMIT in Os_Cfg.h.
+ */
+#define GptConf_PERIODIC_CHANNEL_PRIORITY   (3U)
+#define GptConf_TIMEOUT_CHANNEL_PRIORITY    (3U)
+
+/*
+ * Critical section of the SysTick subscribers table, mapped to the Os services masking all the
+ * interrupts: SysTick_Subscribe moves the entries that the SysTick interrupt walks.
+ */
+#include "Os.h"
+#define GPT_ENTER_CRITICAL()                SuspendAllInterrupts()
+#define GPT_EXIT_CRITICAL()                 ResumeAllInterrupts()
+
+#if (SYSTICK_ISR_STATS == STD_ON)
+/* Timestamp of the SysTick interrupt duration, mapped to the Os port counter (CPU cycles on the target) */
+#include "Os_Port.h"
+#define GPT_GET_TIMESTAMP()                 Os_Port_GetTimestamp()
+#endif
+
+#endif /* GPT_CFG_H */
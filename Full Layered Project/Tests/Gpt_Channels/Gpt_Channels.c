@@ -0,0 +1,144 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Gpt_Channels.c
+ *
+ * Description: Host test of the Gpt channels on the host timers in virtual time, without the Os.
+ *              A 100 us SysTick moves the virtual time between the timer expiries, the services
+ *              are checked after its interrupts:
+ *              - A continuous channel notifies every period, a one-shot channel once, then it
+ *                stays expired (elapsed time at the target, no time remaining).
+ *              - A stopped channel keeps its elapsed time and is not notified, it restarts
+ *                with a new target time.
+ *              - A disabled notification is not called, the channel still expires.
+ *              - A one-shot channel restarts after its expiry.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Gpt.h"
+#include "App.h"
+#include "Host_Test.h"
+
+/* Channel ticks in one microsecond */
+#define CHANNELS_TICKS_PER_US       (GPT_TICK_FREQUENCY / 1000000UL)
+
+/* Period of the SysTick moving the virtual time in microseconds */
+#define CHANNELS_STEP_US            (100UL)
+
+/* Notifications of every channel */
+static uint32 g_Periodic_Notifications = 0;
+static uint32 g_Timeout_Notifications = 0;
+
+/*********************************************************************************************/
+/* Description: Interrupt lock of the SysTick subscription (GPT_ENTER_CRITICAL), no interrupt preempts the host test */
+#if (OS_INTERRUPT_LOCK_TRACE == STD_ON)
+void Os_SuspendAllInterruptsSite(const char * File, uint16 Line)
+#else
+void SuspendAllInterrupts(void)
+#endif
+{
+}
+
+void ResumeAllInterrupts(void)
+{
+}
+
+/*********************************************************************************************/
+void Periodic_Notification(void)
+{
+    g_Periodic_Notifications++;
+}
+
+void Timeout_Notification(void)
+{
+    g_Timeout_Notifications++;
+}
+
+/*********************************************************************************************/
+/* Description: SysTick subscriber, only the interrupt is needed to move the virtual time */
+static void Channels_Step(void)
+{
+}
+
+/*********************************************************************************************/
+/* Description: Deliver the timer interrupts until the SysTick interrupt at Time_Us, Time_Us shall not be a channel expiry */
+static void Channels_RunUntil(uint64 Time_Us)
+{
+    while(SysTick_HostGetTimeUs() < Time_Us)
+    {
+        SysTick_WaitForInterrupt();
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Convert microseconds to channel ticks */
+static Gpt_ValueType Channels_Ticks(uint32 Time_Us)
+{
+    return (Gpt_ValueType)(Time_Us * CHANNELS_TICKS_PER_US);
+}
+
+/*********************************************************************************************/
+int main(void)
+{
+    SysTick_HostSetMode(SYSTICK_HOST_VIRTUAL_TIME);
+    HOST_TEST_CHECK(E_OK == SysTick_Subscribe(Channels_Step, 1U));
+    HOST_TEST_CHECK(E_OK == SysTick_Start(CHANNELS_STEP_US));
+
+    Gpt_Init(&Gpt_Configuration);
+    HOST_TEST_CHECK(0U == Gpt_GetTimeElapsed(GptConf_PERIODIC_CHANNEL_ID_INDEX));
+    HOST_TEST_CHECK(0U == Gpt_GetTimeRemaining(GptConf_PERIODIC_CHANNEL_ID_INDEX));
+    Gpt_EnableNotification(GptConf_PERIODIC_CHANNEL_ID_INDEX);
+    Gpt_EnableNotification(GptConf_TIMEOUT_CHANNEL_ID_INDEX);
+
+    /* Continuous 250 us and one-shot 1000 us from 0 us */
+    Gpt_StartTimer(GptConf_PERIODIC_CHANNEL_ID_INDEX, Channels_Ticks(250U));
+    Gpt_StartTimer(GptConf_TIMEOUT_CHANNEL_ID_INDEX, Channels_Ticks(1000U));
+
+    Channels_RunUntil(300U);
+    HOST_TEST_CHECK(1U == g_Periodic_Notifications);
+    HOST_TEST_CHECK(Channels_Ticks(50U) == Gpt_GetTimeElapsed(GptConf_PERIODIC_CHANNEL_ID_INDEX));
+    HOST_TEST_CHECK(Channels_Ticks(200U) == Gpt_GetTimeRemaining(GptConf_PERIODIC_CHANNEL_ID_INDEX));
+    HOST_TEST_CHECK(Channels_Ticks(300U) == Gpt_GetTimeElapsed(GptConf_TIMEOUT_CHANNEL_ID_INDEX));
+    HOST_TEST_CHECK(Channels_Ticks(700U) == Gpt_GetTimeRemaining(GptConf_TIMEOUT_CHANNEL_ID_INDEX));
+
+    /* The one-shot channel expired at 1000 us and stays expired */
+    Channels_RunUntil(1300U);
+    HOST_TEST_CHECK(5U == g_Periodic_Notifications);
+    HOST_TEST_CHECK(1U == g_Timeout_Notifications);
+    HOST_TEST_CHECK(Channels_Ticks(1000U) == Gpt_GetTimeElapsed(GptConf_TIMEOUT_CHANNEL_ID_INDEX));
+    HOST_TEST_CHECK(0U == Gpt_GetTimeRemaining(GptConf_TIMEOUT_CHANNEL_ID_INDEX));
+
+    /* Stopped at 1300 us, 50 us after its last expiry: the elapsed time is kept */
+    Gpt_StopTimer(GptConf_PERIODIC_CHANNEL_ID_INDEX);
+    Channels_RunUntil(1600U);
+    HOST_TEST_CHECK(5U == g_Periodic_Notifications);
+    HOST_TEST_CHECK(Channels_Ticks(50U) == Gpt_GetTimeElapsed(GptConf_PERIODIC_CHANNEL_ID_INDEX));
+    HOST_TEST_CHECK(Channels_Ticks(200U) == Gpt_GetTimeRemaining(GptConf_PERIODIC_CHANNEL_ID_INDEX));
+
+    /* Restarted with 500 us and its notification disabled: the expiry at 2100 us is not notified */
+    Gpt_DisableNotification(GptConf_PERIODIC_CHANNEL_ID_INDEX);
+    Gpt_StartTimer(GptConf_PERIODIC_CHANNEL_ID_INDEX, Channels_Ticks(500U));
+    Channels_RunUntil(2200U);
+    HOST_TEST_CHECK(5U == g_Periodic_Notifications);
+    HOST_TEST_CHECK(Channels_Ticks(100U) == Gpt_GetTimeElapsed(GptConf_PERIODIC_CHANNEL_ID_INDEX));
+    HOST_TEST_CHECK(Channels_Ticks(400U) == Gpt_GetTimeRemaining(GptConf_PERIODIC_CHANNEL_ID_INDEX));
+
+    /* Notified again from the expiry at 2600 us, the one-shot channel restarts for 200 us */
+    Gpt_EnableNotification(GptConf_PERIODIC_CHANNEL_ID_INDEX);
+    Gpt_StartTimer(GptConf_TIMEOUT_CHANNEL_ID_INDEX, Channels_Ticks(200U));
+    Channels_RunUntil(2700U);
+    HOST_TEST_CHECK(6U == g_Periodic_Notifications);
+    HOST_TEST_CHECK(2U == g_Timeout_Notifications);
+    HOST_TEST_CHECK(Channels_Ticks(200U) == Gpt_GetTimeElapsed(GptConf_TIMEOUT_CHANNEL_ID_INDEX));
+
+    printf("  %lu continuous and %lu one-shot notifications in %lu us\n", (unsigned long)g_Periodic_Notifications,
+           (unsigned long)g_Timeout_Notifications, (unsigned long)SysTick_HostGetTimeUs());
+
+    Gpt_StopTimer(GptConf_PERIODIC_CHANNEL_ID_INDEX);
+    Gpt_DeInit();
+    SysTick_Stop();
+
+    HOST_TEST_END();
+}
@@ -0,0 +1,131 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Gpt_Predef_Timer.c
+ *
+ * Description: Host test of the Gpt predefined timers, without the Os.
+ *              - Virtual time: the timers count from Gpt_Init, every width and resolution
+ *                of Gpt_GetPredefTimerValue is checked against the host time past the
+ *                16-bit and 24-bit wrap arounds, Gpt_GetPredefTimerValue64 counts the
+ *                GPT_TICK_FREQUENCY ticks.
+ *              - Real time (CLOCK_MONOTONIC): the 64-bit timer never goes backwards and
+ *                follows the host time.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Gpt.h"
+#include "Host_Test.h"
+
+/* Predefined timer ticks in one microsecond */
+#define PREDEF_TICKS_PER_US         (GPT_TICK_FREQUENCY / 1000000UL)
+
+/* Period of the SysTick moving the virtual time in microseconds */
+#define PREDEF_STEP_US              (10000UL)
+
+/* Host time of Gpt_Init and of the end of the virtual time check in microseconds */
+#define PREDEF_INIT_US              (50000UL)
+#define PREDEF_END_US               (20000000UL)
+
+/* Reads of the real time check */
+#define PREDEF_REAL_READS           (100000UL)
+
+/*********************************************************************************************/
+/* Description: Interrupt lock of the SysTick subscription (GPT_ENTER_CRITICAL), no interrupt preempts the host test */
+#if (OS_INTERRUPT_LOCK_TRACE == STD_ON)
+void Os_SuspendAllInterruptsSite(const char * File, uint16 Line)
+#else
+void SuspendAllInterrupts(void)
+#endif
+{
+}
+
+void ResumeAllInterrupts(void)
+{
+}
+
+/*********************************************************************************************/
+/* Description: SysTick subscriber, only the interrupt is needed to move the virtual time */
+static void Predef_Step(void)
+{
+}
+
+/*********************************************************************************************/
+/* Description: Check every predefined timer against the time since Gpt_Init */
+static boolean Predef_Check(uint64 Time_Us)
+{
+    boolean ok = TRUE;
+    uint32 value = 0;
+
+    ok &= (Gpt_GetPredefTimerValue64() == (Time_Us * PREDEF_TICKS_PER_US));
+    ok &= (E_OK == Gpt_GetPredefTimerValue(GPT_PREDEF_TIMER_1US_16BIT, &value)) && (value == (Time_Us & 0xFFFFU));
+    ok &= (E_OK == Gpt_GetPredefTimerValue(GPT_PREDEF_TIMER_1US_24BIT, &value)) && (value == (Time_Us & 0xFFFFFFU));
+    ok &= (E_OK == Gpt_GetPredefTimerValue(GPT_PREDEF_TIMER_1US_32BIT, &value)) && (value == (uint32)Time_Us);
+    ok &= (E_OK == Gpt_GetPredefTimerValue(GPT_PREDEF_TIMER_100US_32BIT, &value)) && (value == (uint32)(Time_Us / 100U));
+    return ok;
+}
+
+/*********************************************************************************************/
+int main(void)
+{
+    uint32 errors = 0;
+    uint32 backwards = 0;
+    uint32 read;
+    uint64 last_ticks;
+    uint64 ticks;
+    uint64 host_start_us;
+    uint64 ticks_us;
+    uint64 host_us;
+
+    SysTick_HostSetMode(SYSTICK_HOST_VIRTUAL_TIME);
+    HOST_TEST_CHECK(E_OK == SysTick_Subscribe(Predef_Step, 1U));
+    HOST_TEST_CHECK(E_OK == SysTick_Start(PREDEF_STEP_US));
+
+    /* The timers count from Gpt_Init, not from the start of the host time */
+    while(SysTick_HostGetTimeUs() < PREDEF_INIT_US)
+    {
+        SysTick_WaitForInterrupt();
+    }
+    HOST_TEST_CHECK(0U == Gpt_GetPredefTimerValue64());
+    Gpt_Init(&Gpt_Configuration);
+
+    while(SysTick_HostGetTimeUs() < PREDEF_END_US)
+    {
+        if(FALSE == Predef_Check(SysTick_HostGetTimeUs() - PREDEF_INIT_US))
+        {
+            errors++;
+        }
+        SysTick_WaitForInterrupt();
+    }
+    HOST_TEST_CHECK(0U == errors);
+    printf("  virtual time: %lu us checked, %lu errors\n",
+           (unsigned long)(PREDEF_END_US - PREDEF_INIT_US), (unsigned long)errors);
+
+    /* Real time: the timer follows CLOCK_MONOTONIC from the host time of the switch */
+    SysTick_HostSetMode(SYSTICK_HOST_REAL_TIME);
+    host_start_us = SysTick_HostGetTimeUs();
+    last_ticks = Gpt_GetPredefTimerValue64();
+    for(read = 0; read < PREDEF_REAL_READS; read++)
+    {
+        ticks = Gpt_GetPredefTimerValue64();
+        if(ticks < last_ticks)
+        {
+            backwards++;
+        }
+        last_ticks = ticks;
+    }
+    host_us  = SysTick_HostGetTimeUs();
+    ticks_us = Gpt_GetPredefTimerValue64() / PREDEF_TICKS_PER_US;
+    HOST_TEST_CHECK(0U == backwards);
+    HOST_TEST_CHECK(host_us >= host_start_us);
+    /* Both read the same clock: less than 1 ms apart */
+    HOST_TEST_CHECK(((ticks_us + PREDEF_INIT_US) + 1000U > host_us) && ((ticks_us + PREDEF_INIT_US) < host_us + 1000U));
+    printf("  real time: %lu reads in %lu us, %lu backwards\n", (unsigned long)PREDEF_REAL_READS,
+           (unsigned long)(host_us - host_start_us), (unsigned long)backwards);
+
+    SysTick_Stop();
+    Gpt_DeInit();
+
+    HOST_TEST_END();
+}
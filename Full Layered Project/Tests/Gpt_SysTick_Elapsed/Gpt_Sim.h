@@ -0,0 +1,43 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Gpt_Sim.h
+ *
+ * Description: Simulated SysTick and NVIC registers of the target Gpt.c, included before
+ *              every source of the Gpt_SysTick_Elapsed test (gcc -include). Every access to
+ *              the CURRENT register advances the simulated core clock, the SysTick interrupt
+ *              raised meanwhile is served before the read returns (see Gpt_SysTick_Elapsed.c).
+ *              GPT_SIM builds the target section of Gpt.c on the host instead of Gpt_Host.c,
+ *              with the host type widths.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef GPT_SIM_H_
+#define GPT_SIM_H_
+
+#include "tm4c123gh6pm_registers.h"
+
+/* Simulated registers, the PENDSTSET bit of the Interrupt Control and State register is kept by the simulation */
+extern volatile uint32 g_Gpt_Sim_Ctrl;
+extern volatile uint32 g_Gpt_Sim_Reload;
+extern volatile uint32 g_Gpt_Sim_Int_Ctrl;
+extern volatile uint32 g_Gpt_Sim_Pri3;
+
+/* Description: Advance the simulated core clock and return the CURRENT register */
+volatile uint32 * Gpt_Sim_CurrentReg(void);
+
+#undef SYSTICK_CTRL_REG
+#undef SYSTICK_RELOAD_REG
+#undef SYSTICK_CURRENT_REG
+#undef NVIC_INT_CTRL_REG
+#undef NVIC_SYSTEM_PRI3_REG
+
+#define SYSTICK_CTRL_REG          (g_Gpt_Sim_Ctrl)
+#define SYSTICK_RELOAD_REG        (g_Gpt_Sim_Reload)
+#define SYSTICK_CURRENT_REG       (*Gpt_Sim_CurrentReg())
+#define NVIC_INT_CTRL_REG         (g_Gpt_Sim_Int_Ctrl)
+#define NVIC_SYSTEM_PRI3_REG      (g_Gpt_Sim_Pri3)
+
+#endif /* GPT_SIM_H_ */
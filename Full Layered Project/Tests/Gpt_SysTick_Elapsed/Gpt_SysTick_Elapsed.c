@@ -0,0 +1,249 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Gpt_SysTick_Elapsed.c
+ *
+ * Description: Host test of SysTick_GetElapsedTimeUs of the target Gpt.c on a simulated SysTick.
+ *              - The CURRENT register counts down the simulated core clock, every read of it
+ *                advances the clock by a pseudo-random step. The counter raises the interrupt
+ *                when it reaches 0 and reloads on the next clock, as the SysTick timer does.
+ *              - The raised interrupt is served before the CURRENT read returns, or when
+ *                ResumeAllInterrupts unmasks it: SysTick_Handler then runs between two
+ *                register reads of SysTick_GetElapsedTimeUs.
+ *              The time is read as Os_GetTimeUs does (subscriber periods plus elapsed time),
+ *              it shall never go backwards and shall lie between the simulated time before
+ *              and after the read. The periods with one interrupt and with the software
+ *              extension (several interrupts per period) are both checked.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Gpt.h"
+#include "Host_Test.h"
+
+/* SysTick interrupt served by the simulation */
+extern void SysTick_Handler(void);
+
+/* SysTick Control Register ENABLE bit and PENDSTSET bit in the Interrupt Control and State register */
+#define SIM_ENABLE_MASK             (0x00000001UL)
+#define SIM_PENDING_MASK            (0x04000000UL)
+
+/* SysTick_Start periods of every check, with one interrupt and with the software extension */
+#define SIM_SHORT_PERIOD_US         (1000UL)
+#define SIM_LONG_PERIOD_US          (1000000UL)
+
+/* SysTick_Start periods simulated by every check */
+#define SIM_CHECKED_PERIODS         (20000UL)
+
+/* Longest clock step of a CURRENT read as a part of one interrupt period */
+#define SIM_STEP_DIVIDER            (16U)
+
+/* One time read in SIM_MASKED_EVERY is done with the interrupts masked, for SIM_MASKED_READS reads */
+#define SIM_MASKED_EVERY            (64U)
+#define SIM_MASKED_READS            (3U)
+
+/* Simulated registers of Gpt_Sim.h */
+volatile uint32 g_Gpt_Sim_Ctrl = 0;
+volatile uint32 g_Gpt_Sim_Reload = 0;
+volatile uint32 g_Gpt_Sim_Int_Ctrl = 0;
+volatile uint32 g_Gpt_Sim_Pri3 = 0;
+static volatile uint32 g_Sim_Current = 0;
+
+/* Simulated core clock since the start of the program */
+static uint64 g_Sim_Clock = 0;
+
+/* Longest clock step of a CURRENT read and state of the pseudo-random steps */
+static uint32 g_Sim_Max_Step = 1;
+static uint32 g_Sim_Random = 12345;
+
+/* Nesting of SuspendAllInterrupts and TRUE while SysTick_Handler runs */
+static uint32 g_Sim_Masked = 0;
+static boolean g_Sim_In_Isr = FALSE;
+
+/* TRUE while the test reads the elapsed time and interrupts served during the reads */
+static boolean g_Sim_In_Read = FALSE;
+static uint32 g_Sim_Read_Interrupts = 0;
+
+/* SysTick_Start periods counted by the subscriber, the Os tick count of Os_GetTimeUs */
+static volatile uint32 g_Periods = 0;
+
+/*********************************************************************************************/
+/* Description: Serve the raised SysTick interrupt if the interrupts are not masked */
+static void Sim_ServeInterrupt(void)
+{
+    if(((g_Gpt_Sim_Int_Ctrl & SIM_PENDING_MASK) != 0U) && (0U == g_Sim_Masked) && (FALSE == g_Sim_In_Isr))
+    {
+        g_Gpt_Sim_Int_Ctrl &= ~SIM_PENDING_MASK;
+        if(TRUE == g_Sim_In_Read)
+        {
+            g_Sim_Read_Interrupts++;
+        }
+        g_Sim_In_Isr = TRUE;
+        SysTick_Handler();
+        g_Sim_In_Isr = FALSE;
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Advance the running counter by Clocks core clocks */
+static void Sim_Advance(uint32 Clocks)
+{
+    uint32 step;
+
+    g_Sim_Clock += Clocks;
+    while(Clocks > 0U)
+    {
+        if(0U == g_Sim_Current)
+        {
+            /* The counter reloads on the clock after reaching 0 */
+            g_Sim_Current = g_Gpt_Sim_Reload;
+            Clocks--;
+        }
+        else
+        {
+            step = (Clocks < g_Sim_Current) ? Clocks : g_Sim_Current;
+            g_Sim_Current -= step;
+            Clocks -= step;
+            if(0U == g_Sim_Current)
+            {
+                g_Gpt_Sim_Int_Ctrl |= SIM_PENDING_MASK;
+            }
+        }
+    }
+}
+
+/*********************************************************************************************/
+volatile uint32 * Gpt_Sim_CurrentReg(void)
+{
+    if((g_Gpt_Sim_Ctrl & SIM_ENABLE_MASK) != 0U)
+    {
+        /* Linear congruential steps, at least one clock between two reads */
+        g_Sim_Random = (g_Sim_Random * 1103515245UL) + 12345UL;
+        Sim_Advance(1U + ((g_Sim_Random >> 8) % g_Sim_Max_Step));
+        Sim_ServeInterrupt();
+    }
+    return &g_Sim_Current;
+}
+
+/*********************************************************************************************/
+/* Description: Interrupt lock of the SysTick subscription (GPT_ENTER_CRITICAL), the simulation masks the SysTick */
+#if (OS_INTERRUPT_LOCK_TRACE == STD_ON)
+void Os_SuspendAllInterruptsSite(const char * File, uint16 Line)
+#else
+void SuspendAllInterrupts(void)
+#endif
+{
+    g_Sim_Masked++;
+}
+
+void ResumeAllInterrupts(void)
+{
+    g_Sim_Masked--;
+    Sim_ServeInterrupt();
+}
+
+/*********************************************************************************************/
+/* Description: SysTick subscriber, one call per SysTick_Start period */
+static void Sim_Subscriber(void)
+{
+    g_Periods++;
+}
+
+/*********************************************************************************************/
+/* Description: Read the time in microseconds since the SysTick start as Os_GetTimeUs does */
+static uint64 Sim_GetTimeUs(uint32 Period_Us)
+{
+    uint32 periods;
+    uint32 elapsed_us;
+
+    g_Sim_In_Read = TRUE;
+    do
+    {
+        periods    = g_Periods;
+        elapsed_us = SysTick_GetElapsedTimeUs();
+    } while(periods != g_Periods);
+    g_Sim_In_Read = FALSE;
+
+    return ((uint64)periods * Period_Us) + elapsed_us;
+}
+
+/*********************************************************************************************/
+/* Description: Start the SysTick with Period_Us and check the time reads for SIM_CHECKED_PERIODS periods */
+static void Sim_CheckPeriod(uint32 Period_Us)
+{
+    uint64 start_clock;
+    uint64 before_us;
+    uint64 after_us;
+    uint64 now_us;
+    uint64 last_us = 0;
+    uint32 reads = 0;
+    uint32 backwards = 0;
+    uint32 out_of_range = 0;
+    uint32 read;
+    boolean masked;
+
+    SysTick_Stop();
+    g_Gpt_Sim_Int_Ctrl &= ~SIM_PENDING_MASK;
+    g_Periods = 0;
+    g_Sim_Read_Interrupts = 0;
+    HOST_TEST_CHECK(E_OK == SysTick_Start(Period_Us));
+    g_Sim_Max_Step = (g_Gpt_Sim_Reload + 1U) / SIM_STEP_DIVIDER;
+
+    /* The first period starts when the counter loads the reload value, one clock after the start */
+    start_clock = g_Sim_Clock + 1U;
+
+    while(g_Periods < SIM_CHECKED_PERIODS)
+    {
+        /* Some reads with the interrupts masked: the raised interrupt stays pending */
+        masked = ((reads % SIM_MASKED_EVERY) == 0U) ? TRUE : FALSE;
+        if(TRUE == masked)
+        {
+            SuspendAllInterrupts();
+        }
+        for(read = 0; read < ((TRUE == masked) ? SIM_MASKED_READS : 1U); read++)
+        {
+            /* The read advances the clock at least once before the counter is read */
+            before_us = (g_Sim_Clock + 1U - start_clock) / SYSTICK_COUNTS_PER_US;
+            now_us    = Sim_GetTimeUs(Period_Us);
+            after_us  = (g_Sim_Clock + 1U - start_clock) / SYSTICK_COUNTS_PER_US;
+            reads++;
+
+            if(now_us < last_us)
+            {
+                backwards++;
+            }
+            if((now_us < before_us) || (now_us > after_us))
+            {
+                out_of_range++;
+            }
+            last_us = now_us;
+        }
+        if(TRUE == masked)
+        {
+            ResumeAllInterrupts();
+        }
+    }
+
+    printf("  period %lu us, %lu interrupts per period: %lu reads, %lu interrupts served inside the reads, "
+           "%lu backwards, %lu out of range\n", (unsigned long)Period_Us,
+           (unsigned long)(((uint64)Period_Us * SYSTICK_COUNTS_PER_US) / (g_Gpt_Sim_Reload + 1U)),
+           (unsigned long)reads, (unsigned long)g_Sim_Read_Interrupts,
+           (unsigned long)backwards, (unsigned long)out_of_range);
+    HOST_TEST_CHECK(g_Sim_Read_Interrupts > 0U);
+    HOST_TEST_CHECK(0U == backwards);
+    HOST_TEST_CHECK(0U == out_of_range);
+}
+
+/*********************************************************************************************/
+int main(void)
+{
+    /* The driver runs with the host type widths, as uint32 on the target */
+    HOST_TEST_CHECK(4U == sizeof(uint32));
+    HOST_TEST_CHECK(E_OK == SysTick_Subscribe(Sim_Subscriber, 1U));
+
+    Sim_CheckPeriod(SIM_SHORT_PERIOD_US);
+    Sim_CheckPeriod(SIM_LONG_PERIOD_US);
+
+    HOST_TEST_END();
+}
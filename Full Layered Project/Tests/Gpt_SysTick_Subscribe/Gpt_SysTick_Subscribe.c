@@ -0,0 +1,147 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Gpt_SysTick_Subscribe.c
+ *
+ * Description: Host test of the SysTick subscribers (SysTick_Subscribe) in virtual time, without the Os.
+ *              - Four subscribers with the dividers 5, 1, 3 and 3 are registered out of order,
+ *                the interrupt calls them in the order of their dividers (the same dividers in
+ *                the registration order). A fifth subscriber, a NULL call back and the divider 0
+ *                are rejected.
+ *              - Every subscriber is called once every Divider SysTick_Start periods.
+ *              - After SysTick_ChangePeriod lengthens the interrupts to 4 periods, every
+ *                subscriber is called at most once per interrupt, never before its expiry
+ *                and less than one interrupt period after it: the divider 5 keeps its rate.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Gpt.h"
+#include "Host_Test.h"
+
+/* SysTick_Start period and the lengthened interrupts period in microseconds */
+#define SUBSCRIBE_PERIOD_US         (1000UL)
+#define SUBSCRIBE_LONG_PERIOD_US    (4000UL)
+
+/* Interrupts of every phase of the test */
+#define SUBSCRIBE_SHORT_INTERRUPTS  (30U)
+#define SUBSCRIBE_LONG_INTERRUPTS   (15U)
+
+/* Registered subscribers */
+#define SUBSCRIBE_NUM               (4U)
+
+/* Longest log of the calls of one interrupt */
+#define SUBSCRIBE_LOG_SIZE          (SUBSCRIBE_NUM)
+
+/* Divider of every subscriber, in the registration order */
+static const uint16 g_Dividers[SUBSCRIBE_NUM] = { 5U, 1U, 3U, 3U };
+
+/* Calls of every subscriber and SysTick_Start period of its last call */
+static uint32 g_Calls[SUBSCRIBE_NUM];
+static uint32 g_Last_Call_Period[SUBSCRIBE_NUM];
+
+/* Subscribers called by the last interrupt in the call order */
+static uint32 g_Log[SUBSCRIBE_LOG_SIZE];
+static uint32 g_Log_Num = 0;
+
+/* Subscriber calls too early or too late for their divider */
+static uint32 g_Late_Calls = 0;
+
+/*********************************************************************************************/
+/* Description: Interrupt lock of the SysTick subscription (GPT_ENTER_CRITICAL), no interrupt preempts the host test */
+#if (OS_INTERRUPT_LOCK_TRACE == STD_ON)
+void Os_SuspendAllInterruptsSite(const char * File, uint16 Line)
+#else
+void SuspendAllInterrupts(void)
+#endif
+{
+}
+
+void ResumeAllInterrupts(void)
+{
+}
+
+/*********************************************************************************************/
+/* Description: Count the call of a subscriber and check it against the expiry of its divider */
+static void Subscribe_Call(uint32 Subscriber)
+{
+    uint32 period = (uint32)(SysTick_HostGetTimeUs() / SUBSCRIBE_PERIOD_US);
+    uint32 due = g_Last_Call_Period[Subscriber] + g_Dividers[Subscriber];
+
+    /* A call is due Divider periods after the last expiry, at the first interrupt not before it */
+    if((period < due) || (period >= (due + (SUBSCRIBE_LONG_PERIOD_US / SUBSCRIBE_PERIOD_US))))
+    {
+        g_Late_Calls++;
+    }
+    g_Last_Call_Period[Subscriber] = period - ((period - due) % g_Dividers[Subscriber]);
+    g_Calls[Subscriber]++;
+
+    if(g_Log_Num < SUBSCRIBE_LOG_SIZE)
+    {
+        g_Log[g_Log_Num] = Subscriber;
+    }
+    g_Log_Num++;
+}
+
+static void Subscribe_Divider5(void)  { Subscribe_Call(0U); }
+static void Subscribe_Divider1(void)  { Subscribe_Call(1U); }
+static void Subscribe_Divider3(void)  { Subscribe_Call(2U); }
+static void Subscribe_Divider3b(void) { Subscribe_Call(3U); }
+
+static void (* const g_Call_Backs[SUBSCRIBE_NUM])(void) =
+{
+    Subscribe_Divider5, Subscribe_Divider1, Subscribe_Divider3, Subscribe_Divider3b
+};
+
+/*********************************************************************************************/
+/* Description: Deliver Interrupts SysTick interrupts */
+static void Subscribe_Run(uint32 Interrupts)
+{
+    uint32 interrupt;
+
+    for(interrupt = 0; interrupt < Interrupts; interrupt++)
+    {
+        g_Log_Num = 0;
+        SysTick_WaitForInterrupt();
+    }
+}
+
+/*********************************************************************************************/
+int main(void)
+{
+    uint32 subscriber;
+
+    SysTick_HostSetMode(SYSTICK_HOST_VIRTUAL_TIME);
+
+    HOST_TEST_CHECK(E_NOT_OK == SysTick_Subscribe(NULL_PTR, 1U));
+    HOST_TEST_CHECK(E_NOT_OK == SysTick_Subscribe(Subscribe_Divider1, 0U));
+    for(subscriber = 0; subscriber < SUBSCRIBE_NUM; subscriber++)
+    {
+        HOST_TEST_CHECK(E_OK == SysTick_Subscribe(g_Call_Backs[subscriber], g_Dividers[subscriber]));
+    }
+    HOST_TEST_CHECK(E_NOT_OK == SysTick_Subscribe(Subscribe_Divider1, 1U));
+
+    HOST_TEST_CHECK(E_OK == SysTick_Start(SUBSCRIBE_PERIOD_US));
+    Subscribe_Run(SUBSCRIBE_SHORT_INTERRUPTS);
+
+    /* The last interrupt (30 periods) calls all the subscribers, in the order of their dividers */
+    HOST_TEST_CHECK(SUBSCRIBE_NUM == g_Log_Num);
+    HOST_TEST_CHECK((1U == g_Log[0]) && (2U == g_Log[1]) && (3U == g_Log[2]) && (0U == g_Log[3]));
+    HOST_TEST_CHECK((6U == g_Calls[0]) && (30U == g_Calls[1]) && (10U == g_Calls[2]) && (10U == g_Calls[3]));
+    printf("  %lu us periods: calls %lu/%lu/%lu/%lu for the dividers 5/1/3/3\n", (unsigned long)SUBSCRIBE_PERIOD_US,
+           (unsigned long)g_Calls[0], (unsigned long)g_Calls[1], (unsigned long)g_Calls[2], (unsigned long)g_Calls[3]);
+
+    /* Called right after an interrupt as from a subscriber: the next interrupts are 4 periods apart */
+    HOST_TEST_CHECK(E_OK == SysTick_ChangePeriod(SUBSCRIBE_LONG_PERIOD_US));
+    Subscribe_Run(SUBSCRIBE_LONG_INTERRUPTS);
+
+    /* 60 more periods: the divider 5 keeps its rate, the shorter dividers are called once per interrupt */
+    HOST_TEST_CHECK((18U == g_Calls[0]) && (45U == g_Calls[1]) && (25U == g_Calls[2]) && (25U == g_Calls[3]));
+    HOST_TEST_CHECK(0U == g_Late_Calls);
+    printf("  %lu us interrupts: calls %lu/%lu/%lu/%lu for the dividers 5/1/3/3, %lu late calls\n",
+           (unsigned long)SUBSCRIBE_LONG_PERIOD_US, (unsigned long)g_Calls[0], (unsigned long)g_Calls[1],
+           (unsigned long)g_Calls[2], (unsigned long)g_Calls[3], (unsigned long)g_Late_Calls);
+
+    HOST_TEST_END();
+}
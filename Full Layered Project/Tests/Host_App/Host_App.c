@@ -0,0 +1,161 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Host_App.c
+ *
+ * Description: Host board of the application: main.c and all the drivers run unchanged on Linux.
+ *              - The peripheral registers of the Port, Dio and Mcu drivers (0x40000000, 1MB) are
+ *                plain memory mapped at their target address before main.
+ *              - The SW1 switch (PF4) follows a script of presses, the LED1 output (PF1) is
+ *                printed at every change.
+ *              - The environment selects the host SysTick time source and the end:
+ *                  HOST_APP_TIME=virtual|real   virtual time (default) or real time (timerfd)
+ *                  HOST_APP_STOP_S=<seconds>    end of the run, 0 to run forever (default 10)
+ *              With the default script and stop time the LED shall change 2 times: once for
+ *              the short press, then once for the long press (one toggle per press).
+ *
+ *              Build and run with the project configuration:
+ *                  cd Tests && ./host_test.sh Host_App
+ *                  HOST_APP_TIME=real HOST_APP_STOP_S=0 build/Host_App/Host_App_1
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Gpt.h"
+#include "Dio.h"
+#include "Common_Macros.h"
+#include "tm4c123gh6pm_registers.h"
+#include "Host_Test.h"
+
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+/* Peripheral region of the Port, Dio and Mcu registers (GPIO ports and system control) */
+#define HOST_PERIPHERALS_ADDRESS    (0x40000000UL)
+#define HOST_PERIPHERALS_SIZE       (0x00100000UL)
+
+/* Default end of the run in seconds */
+#define HOST_DEFAULT_STOP_S         (10UL)
+
+/* LED changes of the default script */
+#define HOST_EXPECTED_LED_CHANGES   (2U)
+
+/* One press of the SW1 switch in microseconds of host time */
+typedef struct
+{
+    uint64 Press_Us;
+    uint64 Release_Us;
+} Host_PressType;
+
+/* Script of the SW1 presses: a short press, then a long press held for 2.2s */
+static const Host_PressType Host_Presses[] =
+{
+    { 1000000ULL, 1200000ULL },
+    { 3000000ULL, 5200000ULL }
+};
+
+/* LED1 level seen at the last SysTick interrupt and number of its changes */
+static boolean g_Led_On = FALSE;
+static uint32 g_Led_Changes = 0;
+
+/* TRUE when the run checks the LED changes of the default script */
+static boolean g_Check_Script = FALSE;
+
+/*********************************************************************************************/
+/* Description: SysTick subscriber, drive the SW1 pin from the script and watch the LED1 pin */
+static void Host_BoardTick(void)
+{
+    uint64 now_us = SysTick_HostGetTimeUs();
+    boolean pressed = FALSE;
+    boolean led_on;
+    uint32 press;
+
+    for(press = 0; press < (sizeof(Host_Presses) / sizeof(Host_Presses[0])); press++)
+    {
+        if((now_us >= Host_Presses[press].Press_Us) && (now_us < Host_Presses[press].Release_Us))
+        {
+            pressed = TRUE;
+        }
+    }
+
+    /* The switch pulls the pin low when pressed */
+    if(pressed == TRUE)
+    {
+        CLEAR_BIT(GPIO_PORTF_DATA_REG, DioConf_SW1_CHANNEL_NUM);
+    }
+    else
+    {
+        SET_BIT(GPIO_PORTF_DATA_REG, DioConf_SW1_CHANNEL_NUM);
+    }
+
+    led_on = BIT_IS_SET(GPIO_PORTF_DATA_REG, DioConf_LED1_CHANNEL_NUM) ? TRUE : FALSE;
+    if(led_on != g_Led_On)
+    {
+        g_Led_On = led_on;
+        g_Led_Changes++;
+        printf("  %8.3f s  LED1 %s\n", (double)now_us / 1000000.0, (led_on == TRUE) ? "on" : "off");
+        fflush(stdout);
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Called when the host SysTick reaches the stop time and exits */
+static void Host_BoardEnd(void)
+{
+    if(g_Check_Script == TRUE)
+    {
+        HOST_TEST_CHECK(g_Led_Changes == HOST_EXPECTED_LED_CHANGES);
+        printf("%s\n", (g_Host_Test_Failures == 0U) ? "PASSED" : "FAILED");
+        fflush(stdout);
+        if(g_Host_Test_Failures != 0U)
+        {
+            /* exit shall not be called again from an exit handler */
+            _exit(EXIT_FAILURE);
+        }
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Set up the host board before main */
+__attribute__((constructor)) static void Host_BoardInit(void)
+{
+    const char * time_mode = getenv("HOST_APP_TIME");
+    const char * stop_s = getenv("HOST_APP_STOP_S");
+    uint64 stop_time_us = HOST_DEFAULT_STOP_S * 1000000ULL;
+    void * peripherals;
+
+    peripherals = mmap((void *)HOST_PERIPHERALS_ADDRESS, HOST_PERIPHERALS_SIZE, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    if(peripherals != (void *)HOST_PERIPHERALS_ADDRESS)
+    {
+        printf("Host_App: the peripheral registers cannot be mapped at 0x%08lX\n", HOST_PERIPHERALS_ADDRESS);
+        exit(EXIT_FAILURE);
+    }
+
+    if((time_mode != NULL_PTR) && (strcmp(time_mode, "real") == 0))
+    {
+        SysTick_HostSetMode(SYSTICK_HOST_REAL_TIME);
+    }
+    else
+    {
+        SysTick_HostSetMode(SYSTICK_HOST_VIRTUAL_TIME);
+    }
+
+    if(stop_s != NULL_PTR)
+    {
+        stop_time_us = (uint64)strtoull(stop_s, NULL_PTR, 10) * 1000000ULL;
+    }
+    else
+    {
+        /* Default run: the LED changes of the script are checked */
+        g_Check_Script = TRUE;
+    }
+    SysTick_HostSetStopTime(stop_time_us);
+    (void)atexit(Host_BoardEnd);
+
+    /* The switch is released at the start, the subscriber runs before the Os tick of every interrupt */
+    SET_BIT(GPIO_PORTF_DATA_REG, DioConf_SW1_CHANNEL_NUM);
+    (void)SysTick_Subscribe(Host_BoardTick, 1U);
+}
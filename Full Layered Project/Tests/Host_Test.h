@@ -0,0 +1,38 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Host_Test.h
+ *
+ * Description: Check macros of the host test programs, built and run by host_test.sh.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef HOST_TEST_H_
+#define HOST_TEST_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Number of the failed checks of the test program */
+static unsigned int g_Host_Test_Failures = 0;
+
+/* Check a condition of the test, a failed condition is printed with its line */
+#define HOST_TEST_CHECK(COND) \
+    do { \
+        if(!(COND)) \
+        { \
+            g_Host_Test_Failures++; \
+            printf("    FAILED %s:%d: %s\n", __FILE__, __LINE__, #COND); \
+        } \
+    } while(0)
+
+/* End the test program, the exit status is 0 when all the checks passed */
+#define HOST_TEST_END() \
+    do { \
+        printf("%s\n", (g_Host_Test_Failures == 0U) ? "PASSED" : "FAILED"); \
+        exit((g_Host_Test_Failures == 0U) ? EXIT_SUCCESS : EXIT_FAILURE); \
+    } while(0)
+
+#endif /* HOST_TEST_H_ */
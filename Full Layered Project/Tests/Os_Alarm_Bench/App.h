@@ -0,0 +1,26 @@
+ /******************************************************************************
+ *
+ * Module: application
+ *
+ * File Name: App.h
+ *
+ * Description: Header file for the Tasks of the alarm timer wheel benchmark.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef APP_H_
+#define APP_H_
+
+#include "Std_Types.h"
+
+/* Description: Task executes once and runs the benchmark */
+void Init_Task(void);
+
+/* Description: Task never released */
+void Idle_Task(void);
+
+/* Description: Alarm callback counting the expiries */
+void Alarm_Callback(void);
+
+#endif /* APP_H_ */
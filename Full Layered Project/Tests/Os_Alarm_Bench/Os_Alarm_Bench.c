@@ -0,0 +1,103 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Os_Alarm_Bench.c
+ *
+ * Description: Host benchmark of the alarm timer wheel: cost of one Os tick (Os_NewTimerTick)
+ *              with 0, 1, 100 and 1000 armed cyclic alarms, timed with Os_Port_GetTimestamp.
+ *              The alarms have spread first expiries and cycles, the number of callbacks is
+ *              checked against the expiries computed from them.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Os.h"
+#include "Os_Port.h"
+#include "App.h"
+#include "Host_Test.h"
+
+/* Ticks timed for every number of alarms */
+#define BENCH_TICKS                 (100000UL)
+
+/* Ticks timed at once, the 32-bit nanoseconds timestamp wraps after 4.29s */
+#define BENCH_TICKS_PER_SAMPLE      (1000UL)
+
+/* First expiry and cycle of every alarm, spread over the levels of the wheel */
+#define BENCH_ALARM_INCREMENT(ID)   (1UL + (((uint32)(ID) * 7919UL) % 4096UL))
+#define BENCH_ALARM_CYCLE(ID)       (64UL + (((uint32)(ID) * 104729UL) % 4000UL))
+
+/* Alarm callbacks */
+static uint64 g_Expiries = 0;
+
+/*********************************************************************************************/
+void Alarm_Callback(void)
+{
+    g_Expiries++;
+}
+
+/*********************************************************************************************/
+/* Description: Time BENCH_TICKS Os ticks with Alarms_Num armed alarms */
+static void Bench_Run(AlarmType Alarms_Num)
+{
+    uint64 expected_expiries = 0;
+    uint64 total_ns = 0;
+    uint32 start;
+    uint32 sample;
+    uint32 tick;
+    AlarmType alarm_id;
+
+    for(alarm_id = 0; alarm_id < Alarms_Num; alarm_id++)
+    {
+        HOST_TEST_CHECK(SetRelAlarm(alarm_id, BENCH_ALARM_INCREMENT(alarm_id), BENCH_ALARM_CYCLE(alarm_id)) == E_OK);
+        if(BENCH_ALARM_INCREMENT(alarm_id) <= BENCH_TICKS)
+        {
+            expected_expiries += 1U + ((BENCH_TICKS - BENCH_ALARM_INCREMENT(alarm_id)) / BENCH_ALARM_CYCLE(alarm_id));
+        }
+    }
+
+    g_Expiries = 0;
+    for(sample = 0; sample < (BENCH_TICKS / BENCH_TICKS_PER_SAMPLE); sample++)
+    {
+        start = Os_Port_GetTimestamp();
+        for(tick = 0; tick < BENCH_TICKS_PER_SAMPLE; tick++)
+        {
+            Os_NewTimerTick();
+        }
+        total_ns += (uint32)(Os_Port_GetTimestamp() - start);
+    }
+
+    printf("  %4u alarms: %6.1f ns per tick, %llu expiries\n", (unsigned int)Alarms_Num,
+           (double)total_ns / (double)BENCH_TICKS, (unsigned long long)g_Expiries);
+
+    HOST_TEST_CHECK(g_Expiries == expected_expiries);
+
+    for(alarm_id = 0; alarm_id < Alarms_Num; alarm_id++)
+    {
+        HOST_TEST_CHECK(CancelAlarm(alarm_id) == E_OK);
+    }
+}
+
+/*********************************************************************************************/
+void Init_Task(void)
+{
+    /* The ticks are delivered here, the scheduler never starts */
+    Bench_Run(0U);
+    Bench_Run(1U);
+    Bench_Run(100U);
+    Bench_Run(1000U);
+
+    HOST_TEST_END();
+}
+
+/*********************************************************************************************/
+void Idle_Task(void)
+{
+}
+
+/*********************************************************************************************/
+int main(void)
+{
+    Os_start();
+    return 0;
+}
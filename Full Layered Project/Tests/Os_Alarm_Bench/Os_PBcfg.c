@@ -0,0 +1,57 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_PBcfg.c
+ *
+ * Description: Configuration Source file for Os Scheduler - alarm timer wheel benchmark.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Os.h"
+#include "App.h"
+
+/* Alarm entries calling the benchmark callback, 10^n entries */
+#define OS_ALARM_ENTRIES_1           { OS_ALARM_CALLBACK, OsConf_IDLE_TASK_ID_INDEX, 0U, Alarm_Callback },
+#define OS_ALARM_ENTRIES_10          OS_ALARM_ENTRIES_1 OS_ALARM_ENTRIES_1 OS_ALARM_ENTRIES_1 OS_ALARM_ENTRIES_1 OS_ALARM_ENTRIES_1 \
+                                     OS_ALARM_ENTRIES_1 OS_ALARM_ENTRIES_1 OS_ALARM_ENTRIES_1 OS_ALARM_ENTRIES_1 OS_ALARM_ENTRIES_1
+#define OS_ALARM_ENTRIES_100         OS_ALARM_ENTRIES_10 OS_ALARM_ENTRIES_10 OS_ALARM_ENTRIES_10 OS_ALARM_ENTRIES_10 OS_ALARM_ENTRIES_10 \
+                                     OS_ALARM_ENTRIES_10 OS_ALARM_ENTRIES_10 OS_ALARM_ENTRIES_10 OS_ALARM_ENTRIES_10 OS_ALARM_ENTRIES_10
+#define OS_ALARM_ENTRIES_1000        OS_ALARM_ENTRIES_100 OS_ALARM_ENTRIES_100 OS_ALARM_ENTRIES_100 OS_ALARM_ENTRIES_100 OS_ALARM_ENTRIES_100 \
+                                     OS_ALARM_ENTRIES_100 OS_ALARM_ENTRIES_100 OS_ALARM_ENTRIES_100 OS_ALARM_ENTRIES_100 OS_ALARM_ENTRIES_100
+
+/* Task table, ordered by the task index */
+const Os_TaskConfigType Os_TaskConfiguration[OS_CONFIGURED_TASKS] =
+{
+    { Idle_Task, OsConf_IDLE_TASK_PERIOD, 0U }
+};
+
+/* No task is released by the tick */
+const Os_TaskMaskType Os_DispatchTable[OS_HYPERPERIOD_TICKS] =
+{
+    0U
+};
+
+/* Alarm table, ordered by the alarm index */
+const Os_AlarmConfigType Os_AlarmConfiguration[OS_CONFIGURED_ALARMS] =
+{
+    OS_ALARM_ENTRIES_1000
+};
+
+/* Unused schedule table */
+static const Os_ExpiryPointType Os_UnusedScheduleTablePoints[] =
+{
+    { 0U, 0U }
+};
+
+const Os_ScheduleTableConfigType Os_ScheduleTableConfiguration[OS_CONFIGURED_SCHEDULE_TABLES] =
+{
+    { Os_UnusedScheduleTablePoints, 1U, 1U, FALSE }
+};
+
+/* Unused resource */
+const Os_ResourceConfigType Os_ResourceConfiguration[OS_CONFIGURED_RESOURCES] =
+{
+    { 0U, FALSE }
+};
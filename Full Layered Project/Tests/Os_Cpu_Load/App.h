@@ -0,0 +1,23 @@
+ /******************************************************************************
+ *
+ * Module: application
+ *
+ * File Name: App.h
+ *
+ * Description: Header file for the Tasks of the CPU load test.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef APP_H_
+#define APP_H_
+
+#include "Std_Types.h"
+
+/* Description: Task executes once at the Os start */
+void Init_Task(void);
+
+/* Description: Task executes every tick and keeps the CPU busy for a part of the tick */
+void Load_Task(void);
+
+#endif /* APP_H_ */
@@ -0,0 +1,137 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Os_Cpu_Load.c
+ *
+ * Description: Host test of the CPU load measurement (Os_GetCpuLoad) in virtual time.
+ *              The Load task runs every 1 ms tick and is busy for a part of the tick, the rest
+ *              of the tick is idle. The Os timestamps follow the virtual host time, the Load
+ *              task moves them on by its busy time. The busy part changes every 3 windows of
+ *              50 ticks: 30 %, 70 %, then 10 % for 12 windows.
+ *              - The load of the last window is exactly the busy part of its phase.
+ *              - The peak keeps the 70 % phase for the 10 windows of OS_CPU_LOAD_PEAK_WINDOWS,
+ *                then drops to the 10 % phase.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Os.h"
+#include "Gpt.h"
+#include "App.h"
+#include "Os_Port.h"
+#include "Host_Test.h"
+
+/* Number of the load phases */
+#define LOAD_PHASES                 (3U)
+
+/* Busy part of the tick and last window of every phase */
+static const uint16 g_Phase_Loads[LOAD_PHASES] = { 300U, 700U, 100U };
+static const uint32 g_Phase_End_Windows[LOAD_PHASES] = { 3U, 6U, 18U };
+
+/* Phase of the running tick */
+static uint32 g_Phase = 0;
+
+/* Busy time in nanoseconds since the virtual host time g_Busy_Time_Us */
+static uint32 g_Busy_Ns = 0;
+static uint64 g_Busy_Time_Us = 0;
+
+/*********************************************************************************************/
+/* Description: Timestamp source of the Os in nanoseconds, the virtual host time plus the busy time since it moved */
+static uint32 Load_Timestamp(void)
+{
+    uint64 now_us = SysTick_HostGetTimeUs();
+
+    if(now_us != g_Busy_Time_Us)
+    {
+        /* The tick interrupt moved the virtual time, the task was idle until then */
+        g_Busy_Time_Us = now_us;
+        g_Busy_Ns = 0;
+    }
+    return (uint32)((now_us * 1000ULL) + g_Busy_Ns);
+}
+
+/*********************************************************************************************/
+/* Description: Keep the CPU busy for Busy_Ns nanoseconds of the timestamps */
+static void Load_Busy(uint32 Busy_Ns)
+{
+    (void)Load_Timestamp();
+    g_Busy_Ns += Busy_Ns;
+}
+
+/*********************************************************************************************/
+static TickType Load_GetTick(void)
+{
+    TickType tick = 0;
+
+    (void)GetCounterValue(OsConf_SYSTEM_COUNTER_ID, &tick);
+    return tick;
+}
+
+/*********************************************************************************************/
+/* Description: Check the load and the peak load at the end of a phase */
+static void Load_CheckPhase(uint32 Phase)
+{
+    Os_CpuLoadType load = { 0U, 0U };
+
+    HOST_TEST_CHECK(E_OK == Os_GetCpuLoad(&load));
+    printf("  %u.%u %% busy: load %u.%u %%, peak %u.%u %%\n",
+           (unsigned int)(g_Phase_Loads[Phase] / 10U), (unsigned int)(g_Phase_Loads[Phase] % 10U),
+           (unsigned int)(load.Load / 10U), (unsigned int)(load.Load % 10U),
+           (unsigned int)(load.Peak_Load / 10U), (unsigned int)(load.Peak_Load % 10U));
+
+    HOST_TEST_CHECK(load.Load == g_Phase_Loads[Phase]);
+    if(Phase == 0U)
+    {
+        /* The first window starts one idle tick before the first run of the task (29.4 %), the next two are 30 % */
+        HOST_TEST_CHECK(load.Peak_Load == g_Phase_Loads[0]);
+    }
+    else if(Phase == (LOAD_PHASES - 1U))
+    {
+        /* More than OS_CPU_LOAD_PEAK_WINDOWS windows after the 70 % phase */
+        HOST_TEST_CHECK(load.Peak_Load == g_Phase_Loads[Phase]);
+    }
+    else
+    {
+        HOST_TEST_CHECK(load.Peak_Load == g_Phase_Loads[1]);
+    }
+}
+
+/*********************************************************************************************/
+void Init_Task(void)
+{
+    Os_CpuLoadType load;
+
+    /* No window is complete yet */
+    HOST_TEST_CHECK(E_NOT_OK == Os_GetCpuLoad(&load));
+    HOST_TEST_CHECK(E_NOT_OK == Os_GetCpuLoad(NULL_PTR));
+}
+
+/*********************************************************************************************/
+void Load_Task(void)
+{
+    TickType tick = Load_GetTick();
+
+    /* Busy part of the tick: the load in 0.1 % units of OS_BASE_TIME_US microseconds is in nanoseconds */
+    Load_Busy((uint32)g_Phase_Loads[g_Phase] * OS_BASE_TIME_US);
+
+    /* The phase ends with the first tick of its next window */
+    if(tick >= ((TickType)g_Phase_End_Windows[g_Phase] * OS_CPU_LOAD_WINDOW_TICKS))
+    {
+        Load_CheckPhase(g_Phase);
+        g_Phase++;
+        if(g_Phase >= LOAD_PHASES)
+        {
+            HOST_TEST_END();
+        }
+    }
+}
+
+/*********************************************************************************************/
+int main(void)
+{
+    SysTick_HostSetMode(SYSTICK_HOST_VIRTUAL_TIME);
+    Os_Port_HostSetTimestampSource(Load_Timestamp);
+    Os_start();
+    return 0;
+}
@@ -0,0 +1,26 @@
+ /******************************************************************************
+ *
+ * Module: application
+ *
+ * File Name: App.h
+ *
+ * Description: Header file for the Tasks of the overrun policies test.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef APP_H_
+#define APP_H_
+
+#include "Std_Types.h"
+
+/* Description: Task executes once at the Os start */
+void Init_Task(void);
+
+/* Description: Task executes every tick to count the dispatched ticks */
+void Tick_Task(void);
+
+/* Description: Task executes every 2 ticks, its second execution lasts several ticks */
+void Long_Task(void);
+
+#endif /* APP_H_ */
@@ -0,0 +1,157 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Os_Overrun.c
+ *
+ * Description: Host test of the overrun policies (OS_OVERRUN_POLICY) of both kernels.
+ *              The Tick task runs every tick with the highest priority and the Long task
+ *              every 2 ticks. The second execution of the Long task (tick 4) lasts
+ *              OVERRUN_TICKS ticks: it delivers the host SysTick interrupts itself, so the
+ *              ticks 5 to 9 arrive while it runs and its releases of the ticks 6 and 8 overrun.
+ *
+ *              Cooperative kernel: every tick arriving during the task counts one overrun,
+ *              the Tick task of tick 4 ran before, the ticks 5 to 8 are missed ticks.
+ *              Preemptive kernel: the Tick task preempts the Long task at every tick,
+ *              every release of the still running Long task counts one overrun.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Os.h"
+#include "Os_Port.h"
+#include "App.h"
+#include "Host_Test.h"
+
+/* Ticks elapsed during the overrunning execution of the Long task */
+#define OVERRUN_TICKS               (5U)
+
+/* Execution of the Long task which overruns */
+#define OVERRUN_EXECUTION           (2U)
+
+/* Last tick of the test */
+#define TEST_END_TICK               (20U)
+
+/* Releases of the Long task in the ticks 5 to 9 (ticks 6 and 8) */
+#define OVERRUN_LONG_RELEASES       (2U)
+
+#if (OS_PREEMPTIVE == STD_ON)
+/* Only the releases of the running Long task overrun, the Tick task runs at every tick */
+#define EXPECTED_OVERRUNS           (OVERRUN_LONG_RELEASES)
+#define EXPECTED_MISSED_TICKS       (0U)
+#define EXPECTED_HOOK_CALLS         (OVERRUN_LONG_RELEASES)
+#else
+/* Every tick arriving during the task is an overrun, the scheduler gets the 5 ticks at once */
+#define EXPECTED_OVERRUNS           (OVERRUN_TICKS)
+#define EXPECTED_MISSED_TICKS       (OVERRUN_TICKS - 1U)
+#define EXPECTED_HOOK_CALLS         (1U)
+#endif
+
+#if (OS_OVERRUN_POLICY == OS_OVERRUN_CATCH_UP)
+/* Every release runs, late */
+#define EXPECTED_TICK_RUNS          (TEST_END_TICK)
+#define EXPECTED_LONG_RUNS          (TEST_END_TICK / OsConf_LONG_TASK_PERIOD)
+#else
+/* The missed releases are dropped */
+#define EXPECTED_TICK_RUNS          (TEST_END_TICK - EXPECTED_MISSED_TICKS)
+#define EXPECTED_LONG_RUNS          ((TEST_END_TICK / OsConf_LONG_TASK_PERIOD) - OVERRUN_LONG_RELEASES)
+#endif
+
+/* Executions of every task */
+static uint32 g_Tick_Runs = 0;
+static uint32 g_Long_Runs = 0;
+
+/* Os_OverrunHook calls */
+static uint32 g_Hook_Calls = 0;
+
+/*********************************************************************************************/
+static TickType Test_GetTick(void)
+{
+    TickType tick = 0;
+
+    (void)GetCounterValue(OsConf_SYSTEM_COUNTER_ID, &tick);
+    return tick;
+}
+
+/*********************************************************************************************/
+/* Description: Model the time elapsed during a task: wait for the next SysTick interrupt and run it */
+static void Test_WaitTick(void)
+{
+#if (OS_PREEMPTIVE == STD_ON)
+    Os_Port_HostTick();
+#else
+    Os_Port_WaitForInterrupt();
+#endif
+}
+
+/*********************************************************************************************/
+static void Test_End(void)
+{
+    static const char * const policy_names[] = { "SKIP", "CATCH_UP", "HOOK" };
+
+    printf("  %s kernel, %s: tick task %u runs, long task %u runs, %u overruns, %u hook calls\n",
+           (OS_PREEMPTIVE == STD_ON) ? "preemptive" : "cooperative", policy_names[OS_OVERRUN_POLICY],
+           (unsigned int)g_Tick_Runs, (unsigned int)g_Long_Runs,
+           (unsigned int)Os_GetTaskOverruns(OsConf_LONG_TASK_ID_INDEX), (unsigned int)g_Hook_Calls);
+
+    HOST_TEST_CHECK(Os_GetTaskOverruns(OsConf_LONG_TASK_ID_INDEX) == EXPECTED_OVERRUNS);
+    HOST_TEST_CHECK(Os_GetTaskOverruns(OsConf_TICK_TASK_ID_INDEX) == 0U);
+    HOST_TEST_CHECK(g_Tick_Runs == EXPECTED_TICK_RUNS);
+    HOST_TEST_CHECK(g_Long_Runs == EXPECTED_LONG_RUNS);
+#if (OS_OVERRUN_POLICY == OS_OVERRUN_HOOK)
+    HOST_TEST_CHECK(g_Hook_Calls == EXPECTED_HOOK_CALLS);
+#else
+    HOST_TEST_CHECK(g_Hook_Calls == 0U);
+#endif
+
+    HOST_TEST_END();
+}
+
+#if (OS_OVERRUN_POLICY == OS_OVERRUN_HOOK)
+/*********************************************************************************************/
+void Os_OverrunHook(TaskType Task_Id)
+{
+    HOST_TEST_CHECK(Task_Id == OsConf_LONG_TASK_ID_INDEX);
+    g_Hook_Calls++;
+}
+#endif
+
+/*********************************************************************************************/
+void Init_Task(void)
+{
+    SysTick_HostSetMode(SYSTICK_HOST_VIRTUAL_TIME);
+}
+
+/*********************************************************************************************/
+void Tick_Task(void)
+{
+    g_Tick_Runs++;
+}
+
+/*********************************************************************************************/
+void Long_Task(void)
+{
+    uint32 tick;
+
+    g_Long_Runs++;
+    if(g_Long_Runs == OVERRUN_EXECUTION)
+    {
+        for(tick = 0; tick < OVERRUN_TICKS; tick++)
+        {
+            Test_WaitTick();
+        }
+    }
+
+    /* The Long task runs after the Tick task in every tick */
+    if(Test_GetTick() >= TEST_END_TICK)
+    {
+        Test_End();
+    }
+}
+
+/*********************************************************************************************/
+int main(void)
+{
+    Os_start();
+    return 0;
+}
@@ -0,0 +1,56 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_PBcfg.c
+ *
+ * Description: Configuration Source file for Os Scheduler - overrun policies.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Os.h"
+#include "App.h"
+
+/* Every periodic task period shall divide the configured hyperperiod */
+#if !OS_PERIOD_DIVIDES_HYPERPERIOD(OsConf_TICK_TASK_PERIOD)\
+ || !OS_PERIOD_DIVIDES_HYPERPERIOD(OsConf_LONG_TASK_PERIOD)
+  #error "A periodic task period does not divide OS_HYPERPERIOD_TICKS"
+#endif
+
+/* Task table, ordered by the task index */
+const Os_TaskConfigType Os_TaskConfiguration[OS_CONFIGURED_TASKS] =
+{
+    { Tick_Task, OsConf_TICK_TASK_PERIOD, 0U },
+    { Long_Task, OsConf_LONG_TASK_PERIOD, 0U }
+};
+
+/* Dispatch table of the 2 ticks of the hyperperiod */
+const Os_TaskMaskType Os_DispatchTable[OS_HYPERPERIOD_TICKS] =
+{
+    OS_TASK_MASK(OsConf_TICK_TASK_ID_INDEX) | OS_TASK_MASK(OsConf_LONG_TASK_ID_INDEX),
+    OS_TASK_MASK(OsConf_TICK_TASK_ID_INDEX)
+};
+
+/* Unused alarm */
+const Os_AlarmConfigType Os_AlarmConfiguration[OS_CONFIGURED_ALARMS] =
+{
+    { OS_ALARM_ACTIVATETASK, OsConf_LONG_TASK_ID_INDEX, 0U, NULL_PTR }
+};
+
+/* Unused schedule table */
+static const Os_ExpiryPointType Os_UnusedScheduleTablePoints[] =
+{
+    { 0U, 0U }
+};
+
+const Os_ScheduleTableConfigType Os_ScheduleTableConfiguration[OS_CONFIGURED_SCHEDULE_TABLES] =
+{
+    { Os_UnusedScheduleTablePoints, 1U, 1U, FALSE }
+};
+
+/* Unused resource */
+const Os_ResourceConfigType Os_ResourceConfiguration[OS_CONFIGURED_RESOURCES] =
+{
+    { 0U, FALSE }
+};
@@ -0,0 +1,204 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Os_Queue_Stress.c
+ *
+ * Description: Host stress test of the deferred work queues with POSIX threads.
+ *              - Os_SpscQueue: one producer thread and one consumer thread.
+ *              - Os_MpscQueue: STRESS_PRODUCERS producer threads and one consumer thread.
+ *              Every item carries its producer and its sequence number in the producer,
+ *              the consumer checks that no item is lost or duplicated and that the items
+ *              of every producer arrive in order. The throughput is reported in items/s.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Os_Queue.h"
+#include "Host_Test.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+/* Producer threads of the multi producer queue */
+#define STRESS_PRODUCERS            (4U)
+
+/* Items posted by every producer */
+#define STRESS_ITEMS                (1000000UL)
+
+/* Queue size, small so that the queues are often full and empty */
+#define STRESS_QUEUE_SIZE           (256U)
+
+/* Item data: producer in the upper 8 bits, sequence number in the producer in the lower 24 bits */
+#define STRESS_DATA(PRODUCER, SEQ)  (((uint32)(PRODUCER) << 24) | (uint32)(SEQ))
+#define STRESS_PRODUCER(DATA)       ((DATA) >> 24)
+#define STRESS_SEQ(DATA)            ((DATA) & 0x00FFFFFFUL)
+
+/* Queues under test */
+static Os_WorkItemType g_Spsc_Buffer[STRESS_QUEUE_SIZE];
+static Os_SpscQueueType g_Spsc_Queue;
+static Os_MpscSlotType g_Mpsc_Slots[STRESS_QUEUE_SIZE];
+static Os_MpscQueueType g_Mpsc_Queue;
+
+/* Identifier of every producer thread */
+static uint32 g_Producer_Ids[STRESS_PRODUCERS];
+
+/*********************************************************************************************/
+static double Stress_Seconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+/*********************************************************************************************/
+/* Description: Work item function, never called */
+static void Stress_Work(uint32 Data)
+{
+    (void)Data;
+}
+
+/*********************************************************************************************/
+static void * Stress_SpscProducer(void * Arg)
+{
+    Os_WorkItemType item = { Stress_Work, 0U };
+    uint32 seq;
+
+    (void)Arg;
+    for(seq = 0; seq < STRESS_ITEMS; seq++)
+    {
+        item.Data = STRESS_DATA(0U, seq);
+        while(Os_SpscQueuePost(&g_Spsc_Queue, &item) != E_OK)
+        {
+            /* Full, let the consumer run */
+            sched_yield();
+        }
+    }
+    return NULL_PTR;
+}
+
+/*********************************************************************************************/
+static void * Stress_MpscProducer(void * Arg)
+{
+    uint32 producer = *(const uint32 *)Arg;
+    Os_WorkItemType item = { Stress_Work, 0U };
+    uint32 seq;
+
+    for(seq = 0; seq < STRESS_ITEMS; seq++)
+    {
+        item.Data = STRESS_DATA(producer, seq);
+        while(Os_MpscQueuePost(&g_Mpsc_Queue, &item) != E_OK)
+        {
+            /* Full, let the consumer run */
+            sched_yield();
+        }
+    }
+    return NULL_PTR;
+}
+
+/*********************************************************************************************/
+/*
+ * Description: Consume the items of Producers producers with the Get function of the queue.
+ *              Return the number of the items out of order, duplicated or lost.
+ */
+static uint32 Stress_Consume(Std_ReturnType (*Get_Ptr)(void * Queue, Os_WorkItemType * Item), void * Queue, uint32 Producers)
+{
+    uint32 next_seq[STRESS_PRODUCERS] = { 0U };
+    uint64 received = 0;
+    uint32 errors = 0;
+    uint32 producer;
+    Os_WorkItemType item;
+
+    while(received < ((uint64)Producers * STRESS_ITEMS))
+    {
+        if(Get_Ptr(Queue, &item) == E_OK)
+        {
+            producer = STRESS_PRODUCER(item.Data);
+            if((producer >= Producers) || (item.Work_Ptr != Stress_Work) || (STRESS_SEQ(item.Data) != next_seq[producer]))
+            {
+                errors++;
+            }
+            else
+            {
+                next_seq[producer]++;
+            }
+            received++;
+        }
+        else
+        {
+            /* Empty, let the producers run */
+            sched_yield();
+        }
+    }
+
+    /* Every producer delivered all its items */
+    for(producer = 0; producer < Producers; producer++)
+    {
+        if(next_seq[producer] != STRESS_ITEMS)
+        {
+            errors++;
+        }
+    }
+    return errors;
+}
+
+/*********************************************************************************************/
+static Std_ReturnType Stress_SpscGet(void * Queue, Os_WorkItemType * Item)
+{
+    return Os_SpscQueueGet((Os_SpscQueueType *)Queue, Item);
+}
+
+/*********************************************************************************************/
+static Std_ReturnType Stress_MpscGet(void * Queue, Os_WorkItemType * Item)
+{
+    return Os_MpscQueueGet((Os_MpscQueueType *)Queue, Item);
+}
+
+/*********************************************************************************************/
+int main(void)
+{
+    pthread_t threads[STRESS_PRODUCERS];
+    double start;
+    double seconds;
+    uint32 errors;
+    uint32 producer;
+    Os_WorkItemType item;
+
+    /* Single producer queue */
+    Os_SpscQueueInit(&g_Spsc_Queue, g_Spsc_Buffer, STRESS_QUEUE_SIZE);
+    start = Stress_Seconds();
+    HOST_TEST_CHECK(pthread_create(&threads[0], NULL_PTR, Stress_SpscProducer, NULL_PTR) == 0);
+    errors = Stress_Consume(Stress_SpscGet, &g_Spsc_Queue, 1U);
+    HOST_TEST_CHECK(pthread_join(threads[0], NULL_PTR) == 0);
+    seconds = Stress_Seconds() - start;
+
+    printf("  SPSC: 1 producer, %lu items, %.2f Mitems/s, %u errors\n",
+           (unsigned long)STRESS_ITEMS, ((double)STRESS_ITEMS / seconds) / 1e6, (unsigned int)errors);
+    HOST_TEST_CHECK(errors == 0U);
+    HOST_TEST_CHECK(Os_SpscQueueGet(&g_Spsc_Queue, &item) == E_NOT_OK);
+
+    /* Multi producer queue */
+    Os_MpscQueueInit(&g_Mpsc_Queue, g_Mpsc_Slots, STRESS_QUEUE_SIZE);
+    start = Stress_Seconds();
+    for(producer = 0; producer < STRESS_PRODUCERS; producer++)
+    {
+        g_Producer_Ids[producer] = producer;
+        HOST_TEST_CHECK(pthread_create(&threads[producer], NULL_PTR, Stress_MpscProducer, &g_Producer_Ids[producer]) == 0);
+    }
+    errors = Stress_Consume(Stress_MpscGet, &g_Mpsc_Queue, STRESS_PRODUCERS);
+    for(producer = 0; producer < STRESS_PRODUCERS; producer++)
+    {
+        HOST_TEST_CHECK(pthread_join(threads[producer], NULL_PTR) == 0);
+    }
+    seconds = Stress_Seconds() - start;
+
+    printf("  MPSC: %u producers, %lu items, %.2f Mitems/s, %u errors\n", (unsigned int)STRESS_PRODUCERS,
+           (unsigned long)(STRESS_PRODUCERS * STRESS_ITEMS),
+           ((double)(STRESS_PRODUCERS * STRESS_ITEMS) / seconds) / 1e6, (unsigned int)errors);
+    HOST_TEST_CHECK(errors == 0U);
+    HOST_TEST_CHECK(Os_MpscQueueGet(&g_Mpsc_Queue, &item) == E_NOT_OK);
+
+    HOST_TEST_END();
+}
@@ -0,0 +1,26 @@
+ /******************************************************************************
+ *
+ * Module: application
+ *
+ * File Name: App.h
+ *
+ * Description: Header file for the Tasks of the context switch benchmark.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef APP_H_
+#define APP_H_
+
+#include "Std_Types.h"
+
+/* Description: Task executes once to activate the Ping and Pong tasks */
+void Init_Task(void);
+
+/* Description: Task sends the Ping event and waits for the Pong event, measures the round trips */
+void Ping_Task(void);
+
+/* Description: Task answers every Ping event with the Pong event */
+void Pong_Task(void);
+
+#endif /* APP_H_ */
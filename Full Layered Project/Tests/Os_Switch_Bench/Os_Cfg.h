@@ -0,0 +1,70 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for Os Scheduler - context switch benchmark.
+ *              Preemptive kernel with two extended tasks exchanging events, see the project
+ *              Os_Cfg.h for the description of every option.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef OS_CFG_H_
+#define OS_CFG_H_
+
+/* Os tick in microseconds */
+#define OS_BASE_TIME_US                     (1000UL)
+
+/* Pre-compile options */
+#define OS_GPT_TIME                         (STD_OFF)
+#define OS_PREEMPTIVE                       (STD_ON)
+#define OS_TICKLESS_IDLE                    (STD_OFF)
+#define OS_TASK_STATS                       (STD_OFF)
+#define OS_ISR_PRIORITY_LIMIT               (3U)
+#define OS_INTERRUPT_LOCK_TRACE             (STD_OFF)
+#define OS_LOCK_TRACE_SITES                 (16U)
+#define OS_STACK_MONITOR                    (STD_OFF)
+#define OS_STACK_GUARD_WORDS                (8U)
+#define OS_JITTER_HISTOGRAM                 (STD_OFF)
+#define OS_JITTER_BUCKETS                   (16U)
+#define OS_JITTER_BUCKET_WIDTH_US           (50U)
+#define OS_TRACE                            (STD_OFF)
+#define OS_TRACE_RECORDS                    (256U)
+#define OS_CPU_LOAD                         (STD_OFF)
+#define OS_CPU_LOAD_WINDOW_TICKS            (50U)
+#define OS_CPU_LOAD_PEAK_WINDOWS            (10U)
+
+/* Recovery policies when the tasks of a tick are still running at the next tick */
+#define OS_OVERRUN_SKIP                     (0U)
+#define OS_OVERRUN_CATCH_UP                 (1U)
+#define OS_OVERRUN_HOOK                     (2U)
+#define OS_OVERRUN_POLICY                   (OS_OVERRUN_SKIP)
+
+/* Stack size in bytes of every task context used by the preemptive kernel */
+#define OS_TASK_STACK_SIZE                  (512U)
+
+/* Number of the configured Os Tasks */
+#define OS_CONFIGURED_TASKS                 (2U)
+
+/* Task Index in the array of structures in Os_PBcfg.c, Ping preempts Pong */
+#define OsConf_PING_TASK_ID_INDEX           (uint8)0x00
+#define OsConf_PONG_TASK_ID_INDEX           (uint8)0x01
+
+/* Both tasks are activated once by Init_Task and never end */
+#define OS_TASK_NOT_PERIODIC                (0U)
+#define OsConf_PING_TASK_PERIOD             (OS_TASK_NOT_PERIODIC)
+#define OsConf_PONG_TASK_PERIOD             (OS_TASK_NOT_PERIODIC)
+
+/* No periodic task, the hyperperiod is one tick */
+#define OS_HYPERPERIOD_TICKS                (1U)
+
+/* Unused alarm, counter, schedule table and resource */
+#define OS_CONFIGURED_ALARMS                (1U)
+#define OsConf_SYSTEM_COUNTER_ID            (CounterType)0x00
+#define OS_CONFIGURED_COUNTERS              (1U)
+#define OS_CONFIGURED_SCHEDULE_TABLES       (1U)
+#define OS_CONFIGURED_RESOURCES             (1U)
+
+#endif /* OS_CFG_H_ */
@@ -0,0 +1,49 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_PBcfg.c
+ *
+ * Description: Configuration Source file for Os Scheduler - context switch benchmark.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Os.h"
+#include "App.h"
+
+/* Task table, ordered by the task index */
+const Os_TaskConfigType Os_TaskConfiguration[OS_CONFIGURED_TASKS] =
+{
+    { Ping_Task, OsConf_PING_TASK_PERIOD, 0U },
+    { Pong_Task, OsConf_PONG_TASK_PERIOD, 0U }
+};
+
+/* No task is released by the tick */
+const Os_TaskMaskType Os_DispatchTable[OS_HYPERPERIOD_TICKS] =
+{
+    0U
+};
+
+/* Unused alarm */
+const Os_AlarmConfigType Os_AlarmConfiguration[OS_CONFIGURED_ALARMS] =
+{
+    { OS_ALARM_ACTIVATETASK, OsConf_PONG_TASK_ID_INDEX, 0U, NULL_PTR }
+};
+
+/* Unused schedule table */
+static const Os_ExpiryPointType Os_UnusedScheduleTablePoints[] =
+{
+    { 0U, 0U }
+};
+
+const Os_ScheduleTableConfigType Os_ScheduleTableConfiguration[OS_CONFIGURED_SCHEDULE_TABLES] =
+{
+    { Os_UnusedScheduleTablePoints, 1U, 1U, FALSE }
+};
+
+/* Unused resource */
+const Os_ResourceConfigType Os_ResourceConfiguration[OS_CONFIGURED_RESOURCES] =
+{
+    { 0U, FALSE }
+};
@@ -0,0 +1,100 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Os_Switch_Bench.c
+ *
+ * Description: Host benchmark of the context switch of the preemptive kernel (ucontext port).
+ *              The Ping task sets the event of the lower priority Pong task and waits for its
+ *              answer: every round trip is two context switches, each one with a SetEvent and
+ *              a WaitEvent. The round trips are timed with Os_Port_GetTimestamp.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Os.h"
+#include "Os_Port.h"
+#include "App.h"
+#include "Host_Test.h"
+
+/* Events exchanged by the tasks */
+#define PING_EVENT                  (EventMaskType)0x01
+#define PONG_EVENT                  (EventMaskType)0x01
+
+/* Round trips before the measure and measured round trips */
+#define WARM_UP_ROUND_TRIPS         (1000UL)
+#define MEASURED_ROUND_TRIPS        (200000UL)
+
+/* Round trips timed at once, the 32-bit nanoseconds timestamp wraps after 4.29s */
+#define ROUND_TRIPS_PER_SAMPLE      (1000UL)
+
+/* Ping events answered by the Pong task */
+static volatile uint32 g_Pong_Count = 0;
+
+/*********************************************************************************************/
+static void Ping_RoundTrip(void)
+{
+    (void)SetEvent(OsConf_PONG_TASK_ID_INDEX, PING_EVENT);
+    (void)WaitEvent(PONG_EVENT);
+    (void)ClearEvent(PONG_EVENT);
+}
+
+/*********************************************************************************************/
+void Init_Task(void)
+{
+    (void)ActivateTask(OsConf_PONG_TASK_ID_INDEX);
+    (void)ActivateTask(OsConf_PING_TASK_ID_INDEX);
+}
+
+/*********************************************************************************************/
+void Ping_Task(void)
+{
+    uint32 round_trip;
+    uint32 sample;
+    uint32 start;
+    uint64 total_ns = 0;
+
+    for(round_trip = 0; round_trip < WARM_UP_ROUND_TRIPS; round_trip++)
+    {
+        Ping_RoundTrip();
+    }
+
+    for(sample = 0; sample < (MEASURED_ROUND_TRIPS / ROUND_TRIPS_PER_SAMPLE); sample++)
+    {
+        start = Os_Port_GetTimestamp();
+        for(round_trip = 0; round_trip < ROUND_TRIPS_PER_SAMPLE; round_trip++)
+        {
+            Ping_RoundTrip();
+        }
+        total_ns += (uint32)(Os_Port_GetTimestamp() - start);
+    }
+
+    printf("  %lu round trips, %.1f ns per round trip, %.1f ns per context switch (SetEvent + WaitEvent + switch)\n",
+           (unsigned long)MEASURED_ROUND_TRIPS,
+           (double)total_ns / (double)MEASURED_ROUND_TRIPS,
+           (double)total_ns / (double)(2UL * MEASURED_ROUND_TRIPS));
+
+    /* Every Ping event was answered once */
+    HOST_TEST_CHECK(g_Pong_Count == (WARM_UP_ROUND_TRIPS + MEASURED_ROUND_TRIPS));
+
+    HOST_TEST_END();
+}
+
+/*********************************************************************************************/
+void Pong_Task(void)
+{
+    for(;;)
+    {
+        (void)WaitEvent(PING_EVENT);
+        (void)ClearEvent(PING_EVENT);
+        g_Pong_Count++;
+        (void)SetEvent(OsConf_PING_TASK_ID_INDEX, PONG_EVENT);
+    }
+}
+
+/*********************************************************************************************/
+int main(void)
+{
+    Os_start();
+    return 0;
+}
@@ -0,0 +1,26 @@
+ /******************************************************************************
+ *
+ * Module: application
+ *
+ * File Name: App.h
+ *
+ * Description: Header file for the Tasks of the tickless idle test.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef APP_H_
+#define APP_H_
+
+#include "Std_Types.h"
+
+/* Description: Task executes once to count the SysTick interrupts */
+void Init_Task(void);
+
+/* Description: Task executes every 16 ticks to check its release time */
+void Fast_Task(void);
+
+/* Description: Task executes every 64 ticks to check its release time */
+void Slow_Task(void);
+
+#endif /* APP_H_ */
@@ -0,0 +1,69 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_PBcfg.c
+ *
+ * Description: Configuration Source file for Os Scheduler - tickless idle.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Os.h"
+#include "App.h"
+
+/* Every periodic task period shall divide the configured hyperperiod */
+#if !OS_PERIOD_DIVIDES_HYPERPERIOD(OsConf_FAST_TASK_PERIOD)\
+ || !OS_PERIOD_DIVIDES_HYPERPERIOD(OsConf_SLOW_TASK_PERIOD)
+  #error "A periodic task period does not divide OS_HYPERPERIOD_TICKS"
+#endif
+
+/* Set of the tasks released in one tick of the hyperperiod */
+#define OS_DISPATCH_MASK(TICK) \
+    ( (OS_TASK_RELEASED(TICK, OsConf_FAST_TASK_PERIOD, OsConf_FAST_TASK_OFFSET) << OsConf_FAST_TASK_ID_INDEX) \
+    | (OS_TASK_RELEASED(TICK, OsConf_SLOW_TASK_PERIOD, OsConf_SLOW_TASK_OFFSET) << OsConf_SLOW_TASK_ID_INDEX) )
+
+/* Entries of 2^n ticks from TICK */
+#define OS_DISPATCH_ROWS_1(TICK)     OS_DISPATCH_MASK(TICK),
+#define OS_DISPATCH_ROWS_2(TICK)     OS_DISPATCH_ROWS_1(TICK)   OS_DISPATCH_ROWS_1((TICK) + 1U)
+#define OS_DISPATCH_ROWS_4(TICK)     OS_DISPATCH_ROWS_2(TICK)   OS_DISPATCH_ROWS_2((TICK) + 2U)
+#define OS_DISPATCH_ROWS_8(TICK)     OS_DISPATCH_ROWS_4(TICK)   OS_DISPATCH_ROWS_4((TICK) + 4U)
+#define OS_DISPATCH_ROWS_16(TICK)    OS_DISPATCH_ROWS_8(TICK)   OS_DISPATCH_ROWS_8((TICK) + 8U)
+#define OS_DISPATCH_ROWS_32(TICK)    OS_DISPATCH_ROWS_16(TICK)  OS_DISPATCH_ROWS_16((TICK) + 16U)
+#define OS_DISPATCH_ROWS_64(TICK)    OS_DISPATCH_ROWS_32(TICK)  OS_DISPATCH_ROWS_32((TICK) + 32U)
+
+/* Task table, ordered by the task index */
+const Os_TaskConfigType Os_TaskConfiguration[OS_CONFIGURED_TASKS] =
+{
+    { Fast_Task, OsConf_FAST_TASK_PERIOD, OsConf_FAST_TASK_OFFSET },
+    { Slow_Task, OsConf_SLOW_TASK_PERIOD, OsConf_SLOW_TASK_OFFSET }
+};
+
+/* Dispatch table of the 64 ticks of the hyperperiod */
+const Os_TaskMaskType Os_DispatchTable[OS_HYPERPERIOD_TICKS] =
+{
+    OS_DISPATCH_ROWS_64(0U)
+};
+
+/* Unused alarm */
+const Os_AlarmConfigType Os_AlarmConfiguration[OS_CONFIGURED_ALARMS] =
+{
+    { OS_ALARM_ACTIVATETASK, OsConf_SLOW_TASK_ID_INDEX, 0U, NULL_PTR }
+};
+
+/* Unused schedule table */
+static const Os_ExpiryPointType Os_UnusedScheduleTablePoints[] =
+{
+    { 0U, 0U }
+};
+
+const Os_ScheduleTableConfigType Os_ScheduleTableConfiguration[OS_CONFIGURED_SCHEDULE_TABLES] =
+{
+    { Os_UnusedScheduleTablePoints, 1U, 1U, FALSE }
+};
+
+/* Unused resource */
+const Os_ResourceConfigType Os_ResourceConfiguration[OS_CONFIGURED_RESOURCES] =
+{
+    { 0U, FALSE }
+};
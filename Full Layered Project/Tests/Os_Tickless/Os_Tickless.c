@@ -0,0 +1,133 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Os_Tickless.c
+ *
+ * Description: Host test of the tickless idle mode, 4 hours of virtual time of the host SysTick.
+ *              Every task release is compared with its nominal time (release tick * OS_BASE_TIME_US)
+ *              read from the host time and from Os_GetTimeUs: the drift shall stay 0 since every
+ *              SysTick period starts from the previous expiry. The SysTick interrupts are counted
+ *              and shall only come at the ticks releasing a task.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Os.h"
+#include "Gpt.h"
+#include "App.h"
+#include "Host_Test.h"
+
+/* Virtual time of the test in microseconds */
+#define TEST_DURATION_US            (4ULL * 3600ULL * 1000000ULL)
+
+/* Last Os tick of the test */
+#define TEST_END_TICK               (TEST_DURATION_US / OS_BASE_TIME_US)
+
+/* SysTick interrupts */
+static uint64 g_Wakeups = 0;
+
+/* Releases of every task */
+static uint64 g_Fast_Releases = 0;
+static uint64 g_Slow_Releases = 0;
+
+/* Largest difference between the release times and the nominal ones in microseconds */
+static uint64 g_Max_Host_Drift_Us = 0;
+static uint64 g_Max_Os_Drift_Us = 0;
+
+/*********************************************************************************************/
+static uint64 Test_Difference(uint64 Time_A, uint64 Time_B)
+{
+    return (Time_A > Time_B) ? (Time_A - Time_B) : (Time_B - Time_A);
+}
+
+/*********************************************************************************************/
+static void Test_CheckRelease(uint64 Release_Tick)
+{
+    uint64 nominal_us = Release_Tick * OS_BASE_TIME_US;
+    uint64 host_drift_us = Test_Difference(SysTick_HostGetTimeUs(), nominal_us);
+    uint64 os_drift_us = Test_Difference(Os_GetTimeUs(), nominal_us);
+
+    if(host_drift_us > g_Max_Host_Drift_Us)
+    {
+        g_Max_Host_Drift_Us = host_drift_us;
+    }
+    if(os_drift_us > g_Max_Os_Drift_Us)
+    {
+        g_Max_Os_Drift_Us = os_drift_us;
+    }
+}
+
+/*********************************************************************************************/
+/* Description: SysTick subscriber called at every SysTick interrupt */
+static void Test_CountWakeup(void)
+{
+    g_Wakeups++;
+}
+
+/*********************************************************************************************/
+static void Test_End(void)
+{
+    uint64 expected_wakeups = 0;
+    uint64 tick;
+
+    /* The first SysTick period is one tick, then the interrupts only come at the releases */
+    for(tick = 1; tick <= TEST_END_TICK; tick++)
+    {
+        if((tick == 1U) || (OS_TASK_RELEASED(tick % OS_HYPERPERIOD_TICKS, OsConf_FAST_TASK_PERIOD, OsConf_FAST_TASK_OFFSET) != 0U)
+           || (OS_TASK_RELEASED(tick % OS_HYPERPERIOD_TICKS, OsConf_SLOW_TASK_PERIOD, OsConf_SLOW_TASK_OFFSET) != 0U))
+        {
+            expected_wakeups++;
+        }
+    }
+
+    printf("  %llu s of virtual time, %llu SysTick interrupts instead of %llu ticks\n",
+           (unsigned long long)(SysTick_HostGetTimeUs() / 1000000ULL),
+           (unsigned long long)g_Wakeups, (unsigned long long)TEST_END_TICK);
+    printf("  releases: fast %llu, slow %llu, max drift: host time %llu us, Os_GetTimeUs %llu us\n",
+           (unsigned long long)g_Fast_Releases, (unsigned long long)g_Slow_Releases,
+           (unsigned long long)g_Max_Host_Drift_Us, (unsigned long long)g_Max_Os_Drift_Us);
+
+    HOST_TEST_CHECK(SysTick_HostGetTimeUs() == TEST_DURATION_US);
+    HOST_TEST_CHECK(g_Wakeups == expected_wakeups);
+    HOST_TEST_CHECK(g_Fast_Releases == (TEST_END_TICK / OsConf_FAST_TASK_PERIOD));
+    HOST_TEST_CHECK(g_Slow_Releases == (((TEST_END_TICK - OsConf_SLOW_TASK_OFFSET) / OsConf_SLOW_TASK_PERIOD) + 1U));
+    HOST_TEST_CHECK(g_Max_Host_Drift_Us == 0U);
+    HOST_TEST_CHECK(g_Max_Os_Drift_Us == 0U);
+
+    HOST_TEST_END();
+}
+
+/*********************************************************************************************/
+void Init_Task(void)
+{
+    SysTick_HostSetMode(SYSTICK_HOST_VIRTUAL_TIME);
+    (void)SysTick_Subscribe(Test_CountWakeup, 1U);
+}
+
+/*********************************************************************************************/
+void Fast_Task(void)
+{
+    /* Tick 0 is not a release, the first one is at the first period */
+    g_Fast_Releases++;
+    Test_CheckRelease(g_Fast_Releases * OsConf_FAST_TASK_PERIOD);
+
+    if((g_Fast_Releases * OsConf_FAST_TASK_PERIOD) >= TEST_END_TICK)
+    {
+        Test_End();
+    }
+}
+
+/*********************************************************************************************/
+void Slow_Task(void)
+{
+    Test_CheckRelease(OsConf_SLOW_TASK_OFFSET + (g_Slow_Releases * OsConf_SLOW_TASK_PERIOD));
+    g_Slow_Releases++;
+}
+
+/*********************************************************************************************/
+int main(void)
+{
+    Os_start();
+    return 0;
+}
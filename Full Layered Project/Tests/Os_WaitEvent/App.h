@@ -0,0 +1,26 @@
+ /******************************************************************************
+ *
+ * Module: application
+ *
+ * File Name: App.h
+ *
+ * Description: Header file for the Tasks of the WaitEvent test.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef APP_H_
+#define APP_H_
+
+#include "Std_Types.h"
+
+/* Description: Task executes once to activate the Waiter and Setter tasks */
+void Init_Task(void);
+
+/* Description: Task calls WaitEvent inside and outside the interrupt locks */
+void Waiter_Task(void);
+
+/* Description: Task sets the event of the blocked Waiter task */
+void Setter_Task(void);
+
+#endif /* APP_H_ */
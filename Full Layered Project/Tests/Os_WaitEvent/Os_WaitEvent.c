@@ -0,0 +1,66 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Os_WaitEvent.c
+ *
+ * Description: Host test of WaitEvent with the preemptive kernel. Inside SuspendOSInterrupts
+ *              or SuspendAllInterrupts the task cannot be switched out, WaitEvent shall return
+ *              E_OS_ACCESS without blocking. Outside the locks it blocks until the lower
+ *              priority Setter task sets the event.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Os.h"
+#include "App.h"
+#include "Host_Test.h"
+
+/* Event set by the Setter task */
+#define WAKE_UP_EVENT               (EventMaskType)0x01
+
+/* Set once the Setter task ran */
+static volatile boolean g_Setter_Ran = FALSE;
+
+/*********************************************************************************************/
+void Init_Task(void)
+{
+    (void)ActivateTask(OsConf_SETTER_TASK_ID_INDEX);
+    (void)ActivateTask(OsConf_WAITER_TASK_ID_INDEX);
+}
+
+/*********************************************************************************************/
+void Waiter_Task(void)
+{
+    SuspendOSInterrupts();
+    HOST_TEST_CHECK(WaitEvent(WAKE_UP_EVENT) == E_OS_ACCESS);
+    ResumeOSInterrupts();
+
+    SuspendAllInterrupts();
+    HOST_TEST_CHECK(WaitEvent(WAKE_UP_EVENT) == E_OS_ACCESS);
+    ResumeAllInterrupts();
+
+    /* The locks did not let the Setter task run */
+    HOST_TEST_CHECK(g_Setter_Ran == FALSE);
+
+    /* Without lock the task blocks until the Setter task sets the event */
+    HOST_TEST_CHECK(WaitEvent(WAKE_UP_EVENT) == E_OK);
+    HOST_TEST_CHECK(g_Setter_Ran == TRUE);
+    (void)ClearEvent(WAKE_UP_EVENT);
+
+    HOST_TEST_END();
+}
+
+/*********************************************************************************************/
+void Setter_Task(void)
+{
+    g_Setter_Ran = TRUE;
+    (void)SetEvent(OsConf_WAITER_TASK_ID_INDEX, WAKE_UP_EVENT);
+}
+
+/*********************************************************************************************/
+int main(void)
+{
+    Os_start();
+    return 0;
+}
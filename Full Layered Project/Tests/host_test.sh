@@ -0,0 +1,78 @@
+#!/bin/bash
+#
+# Module: Tests
+#
+# File Name: host_test.sh
+#
+# Description: Build and run the host tests of the Os and Gpt drivers (Linux, gcc).
+#                ./host_test.sh                   every test
+#                ./host_test.sh Os_Overrun ...    the given tests
+#              Every test directory <Test>/ holds the test program <Test>.c, the configuration files
+#              replacing the project ones (Os_Cfg.h, Os_PBcfg.c, App.h ...) and test.cfg setting:
+#                TEST_SOURCES   project sources linked with the test program
+#                TEST_CFLAGS    extra compiler flags
+#                TEST_LIBS      extra libraries
+#                TEST_VARIANTS  one line of compiler flags per build of the test, one build if empty
+#              The project sources and the test files are copied in build/<Test>/ (BUILD_DIR),
+#              so the quoted includes of the Os sources find the test configuration.
+#
+# Author: Mohamed Tarek
+#
+
+TESTS_DIR=$(cd "$(dirname "$0")" && pwd)
+PROJECT_DIR=$(dirname "$TESTS_DIR")
+BUILD_DIR=${BUILD_DIR:-$TESTS_DIR/build}
+CC=${CC:-gcc}
+
+# The unused parameters (Det stubs) and the flat PBcfg initializers are the project style
+BASE_CFLAGS="-std=gnu99 -O2 -g -Wall -Wextra -Wno-unused-parameter -Wno-missing-braces"
+
+# Os kernel with the Gpt SysTick and its host backends
+OS_SOURCES="Os.c Os_PBcfg.c Os_Port_Host.c Os_Queue.c Os_Trace.c Os_Coroutine.c Os_Jitter_Host.c \
+Gpt.c Gpt_Host.c Gpt_PBcfg.c Mcu.c Mcu_PBcfg.c Det.c"
+
+if [ $# -eq 0 ]; then
+    set -- $(cd "$TESTS_DIR" && for dir in */; do [ -f "$dir/test.cfg" ] && echo "${dir%/}"; done)
+fi
+
+failures=0
+for test in "$@"; do
+    if [ ! -f "$TESTS_DIR/$test/test.cfg" ]; then
+        echo "$test: no test.cfg"
+        failures=$((failures + 1))
+        continue
+    fi
+
+    TEST_SOURCES=$OS_SOURCES
+    TEST_CFLAGS=""
+    TEST_LIBS=""
+    TEST_VARIANTS=""
+    . "$TESTS_DIR/$test/test.cfg"
+
+    dir="$BUILD_DIR/$test"
+    rm -rf "$dir"
+    mkdir -p "$dir"
+    cp "$PROJECT_DIR"/*.c "$PROJECT_DIR"/*.h "$TESTS_DIR"/*.h "$dir"/
+    cp "$TESTS_DIR/$test"/* "$dir"/
+
+    variant_num=0
+    while IFS= read -r variant_flags; do
+        variant_num=$((variant_num + 1))
+        program="$dir/${test}_$variant_num"
+        echo "=== $test $variant_flags"
+        if ! (cd "$dir" && $CC $BASE_CFLAGS $TEST_CFLAGS $variant_flags -I. -o "$program" "$test.c" $TEST_SOURCES $TEST_LIBS); then
+            echo "$test: build failed"
+            failures=$((failures + 1))
+        elif ! (cd "$dir" && "$program"); then
+            echo "$test: failed"
+            failures=$((failures + 1))
+        fi
+    done <<< "$TEST_VARIANTS"
+done
+
+if [ $failures -eq 0 ]; then
+    echo "All host tests passed"
+else
+    echo "$failures host test program(s) failed"
+fi
+[ $failures -eq 0 ]
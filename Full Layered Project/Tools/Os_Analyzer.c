@@ -0,0 +1,277 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Analyzer.c
+ *
+ * Description: Host tool for the schedulability analysis of the Os task set.
+ *              It reads the periods, offsets, priorities and worst case execution
+ *              times from Os_Cfg.h and reports:
+ *              - The CPU utilisation.
+ *              - The load of every tick of the hyperperiod, flagging the overloaded
+ *                ticks, the peak ticks and the ticks releasing all the tasks.
+ *              - The worst case response time of every task for the configured
+ *                kernel (cooperative dispatch in ticks or preemptive fixed-priority),
+ *                with the blocking by the lower priority users of the resources.
+ *              The exit status is 1 for an infeasible task set so it can stop a build:
+ *                  gcc -I.. -o Os_Analyzer Os_Analyzer.c && ./Os_Analyzer
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "Os.h"
+
+/* Structure describes one task as seen by the analysis */
+typedef struct
+{
+    const char * Name;
+    TaskType Task_Id;
+    /* Period in Os ticks, OS_TASK_NOT_PERIODIC for a task started by ActivateTask */
+    TickType Period;
+    TickType Offset;
+    /* Shortest time between two releases in Os ticks, the period of a periodic task */
+    TickType Min_Interarrival;
+    /* Worst case execution time in microseconds */
+    uint32 Wcet;
+} Os_AnalyzerTaskType;
+
+/* Task set, keep it in line with the task table in Os_PBcfg.c */
+static const Os_AnalyzerTaskType Os_AnalyzerTasks[OS_CONFIGURED_TASKS] =
+{
+    { "Button_Task", OsConf_BUTTON_TASK_ID_INDEX, OsConf_BUTTON_TASK_PERIOD, OsConf_BUTTON_TASK_OFFSET, OsConf_BUTTON_TASK_PERIOD,        OsConf_BUTTON_TASK_WCET },
+    { "App_Task",    OsConf_APP_TASK_ID_INDEX,    OsConf_APP_TASK_PERIOD,    OsConf_APP_TASK_OFFSET,    OsConf_APP_TASK_MIN_INTERARRIVAL, OsConf_APP_TASK_WCET    },
+    { "Led_Task",    OsConf_LED_TASK_ID_INDEX,    OsConf_LED_TASK_PERIOD,    OsConf_LED_TASK_OFFSET,    OsConf_LED_TASK_PERIOD,           OsConf_LED_TASK_WCET    }
+};
+
+#if (OS_PREEMPTIVE == STD_ON)
+/* Structure describes one resource as seen by the analysis */
+typedef struct
+{
+    const char * Name;
+    Os_TaskMaskType Users;
+    /* Longest time a user holds the resource in microseconds */
+    uint32 Wcet;
+} Os_AnalyzerResourceType;
+
+/* Resource set, keep it in line with the resource table in Os_PBcfg.c */
+static const Os_AnalyzerResourceType Os_AnalyzerResources[OS_CONFIGURED_RESOURCES] =
+{
+    { "Dio", OsConf_DIO_RESOURCE_USERS, OsConf_DIO_RESOURCE_WCET }
+};
+#endif
+
+/* Task set sorted by priority, index 0 is the highest priority */
+static const Os_AnalyzerTaskType * g_Task_By_Priority[OS_CONFIGURED_TASKS];
+
+/*********************************************************************************************/
+/* Description: Return TRUE if a task can run in the given tick of the hyperperiod */
+static boolean Os_AnalyzerRunsInTick(const Os_AnalyzerTaskType * Task, TickType Tick)
+{
+    boolean result = TRUE;
+
+    if(Task->Period != OS_TASK_NOT_PERIODIC)
+    {
+        result = (OS_TASK_RELEASED(Tick, Task->Period, Task->Offset) == 1UL) ? TRUE : FALSE;
+    }
+    return result;
+}
+
+/*********************************************************************************************/
+/* Description: Print the load of every tick of the hyperperiod, return the number of overloaded ticks */
+static uint32 Os_AnalyzerFrames(void)
+{
+    uint32 frame_load[OS_HYPERPERIOD_TICKS];
+    uint32 tasks_count[OS_HYPERPERIOD_TICKS];
+    uint32 peak_load = 0;
+    uint32 overloaded = 0;
+    TickType tick;
+    uint8 index;
+
+    for(tick = 0; tick < OS_HYPERPERIOD_TICKS; tick++)
+    {
+        frame_load[tick]  = 0;
+        tasks_count[tick] = 0;
+        for(index = 0; index < OS_CONFIGURED_TASKS; index++)
+        {
+            if(Os_AnalyzerRunsInTick(&Os_AnalyzerTasks[index], tick) == TRUE)
+            {
+                frame_load[tick] += Os_AnalyzerTasks[index].Wcet;
+                tasks_count[tick]++;
+            }
+        }
+        if(frame_load[tick] > peak_load)
+        {
+            peak_load = frame_load[tick];
+        }
+    }
+
+    printf("\nLoad of every tick (%lu us each):\n", (unsigned long)OS_BASE_TIME_US);
+    printf("  %-8s %-10s %-8s %s\n", "Time(us)", "Load(us)", "Load(%)", "Tasks");
+    for(tick = 0; tick < OS_HYPERPERIOD_TICKS; tick++)
+    {
+        printf("  %-8lu %-10lu %-8.1f", (unsigned long)(tick * OS_BASE_TIME_US), (unsigned long)frame_load[tick],
+               (100.0 * frame_load[tick]) / OS_FRAME_TIME_US);
+        for(index = 0; index < OS_CONFIGURED_TASKS; index++)
+        {
+            if(Os_AnalyzerRunsInTick(g_Task_By_Priority[index], tick) == TRUE)
+            {
+                printf(" %s", g_Task_By_Priority[index]->Name);
+            }
+        }
+        if(frame_load[tick] > OS_FRAME_TIME_US)
+        {
+            printf("  <- OVERLOADED");
+            overloaded++;
+        }
+        if(frame_load[tick] == peak_load)
+        {
+            printf("  <- peak");
+        }
+        if(tasks_count[tick] == OS_CONFIGURED_TASKS)
+        {
+            printf("  <- all the tasks pile up");
+        }
+        printf("\n");
+    }
+    return overloaded;
+}
+
+#if (OS_PREEMPTIVE == STD_OFF)
+/*********************************************************************************************/
+/* Description: Worst case response time of a task in the cooperative scheduler, the tasks of a tick run in priority order */
+static uint32 Os_AnalyzerCooperativeResponse(uint8 Priority)
+{
+    uint32 response = 0;
+    uint32 tick_response;
+    TickType tick;
+    uint8 index;
+
+    for(tick = 0; tick < OS_HYPERPERIOD_TICKS; tick++)
+    {
+        if(Os_AnalyzerRunsInTick(g_Task_By_Priority[Priority], tick) == TRUE)
+        {
+            tick_response = 0;
+            for(index = 0; index <= Priority; index++)
+            {
+                if(Os_AnalyzerRunsInTick(g_Task_By_Priority[index], tick) == TRUE)
+                {
+                    tick_response += g_Task_By_Priority[index]->Wcet;
+                }
+            }
+            if(tick_response > response)
+            {
+                response = tick_response;
+            }
+        }
+    }
+    return response;
+}
+#else
+/*********************************************************************************************/
+/*
+ * Description: Longest blocking of a task by the lower priority tasks with the immediate priority
+ *              ceiling protocol: one critical section of a resource with a ceiling at or above its priority.
+ */
+static uint32 Os_AnalyzerBlocking(uint8 Priority)
+{
+    uint32 blocking = 0;
+    Os_TaskMaskType users;
+    uint8 index;
+
+    for(index = 0; index < OS_CONFIGURED_RESOURCES; index++)
+    {
+        users = Os_AnalyzerResources[index].Users;
+        if((users != 0U) && ((TaskType)__builtin_ctz(users) <= Priority) && ((users >> Priority) > 1U)
+           && (Os_AnalyzerResources[index].Wcet > blocking))
+        {
+            blocking = Os_AnalyzerResources[index].Wcet;
+        }
+    }
+    return blocking;
+}
+
+/*********************************************************************************************/
+/* Description: Worst case response time of a task in the preemptive kernel (fixed-point iteration, offsets ignored) */
+static uint64 Os_AnalyzerPreemptiveResponse(uint8 Priority, uint64 Deadline)
+{
+    uint64 response = g_Task_By_Priority[Priority]->Wcet + Os_AnalyzerBlocking(Priority);
+    uint64 previous = 0;
+    uint64 period;
+    uint8 index;
+
+    while((response != previous) && (response <= Deadline))
+    {
+        previous = response;
+        response = g_Task_By_Priority[Priority]->Wcet + Os_AnalyzerBlocking(Priority);
+        for(index = 0; index < Priority; index++)
+        {
+            period    = (uint64)g_Task_By_Priority[index]->Min_Interarrival * OS_FRAME_TIME_US;
+            response += ((previous + period - 1U) / period) * g_Task_By_Priority[index]->Wcet;
+        }
+    }
+    return response;
+}
+#endif
+
+/*********************************************************************************************/
+int main(void)
+{
+    double utilisation = 0.0;
+    boolean feasible = TRUE;
+    uint64 deadline;
+    uint64 response;
+    uint32 blocking;
+    uint8 index;
+
+    for(index = 0; index < OS_CONFIGURED_TASKS; index++)
+    {
+        g_Task_By_Priority[Os_AnalyzerTasks[index].Task_Id] = &Os_AnalyzerTasks[index];
+        utilisation += (double)Os_AnalyzerTasks[index].Wcet / ((double)Os_AnalyzerTasks[index].Min_Interarrival * OS_FRAME_TIME_US);
+    }
+
+    printf("Os task set: %u tasks, tick %lu us, hyperperiod %lu ticks, %s kernel\n", (unsigned)OS_CONFIGURED_TASKS,
+           (unsigned long)OS_BASE_TIME_US, (unsigned long)OS_HYPERPERIOD_TICKS, (OS_PREEMPTIVE == STD_ON) ? "preemptive" : "cooperative");
+    printf("CPU utilisation: %.2f %%\n", utilisation * 100.0);
+    if(utilisation > 1.0)
+    {
+        feasible = FALSE;
+    }
+
+    if(Os_AnalyzerFrames() != 0U)
+    {
+        /* An overloaded tick delays the next tick in the cooperative scheduler */
+        if(OS_PREEMPTIVE == STD_OFF)
+        {
+            feasible = FALSE;
+        }
+    }
+
+    printf("\nWorst case response times:\n");
+    printf("  %-4s %-12s %-8s %-10s %-10s %-10s %-12s %s\n", "Prio", "Task", "Period", "WCET(us)", "Block(us)", "WCRT(us)", "Deadline(us)", "");
+    for(index = 0; index < OS_CONFIGURED_TASKS; index++)
+    {
+        deadline = (uint64)g_Task_By_Priority[index]->Min_Interarrival * OS_FRAME_TIME_US;
+#if (OS_PREEMPTIVE == STD_ON)
+        blocking = Os_AnalyzerBlocking(index);
+        response = Os_AnalyzerPreemptiveResponse(index, deadline);
+#else
+        /* The tasks run to completion, a lower priority task never holds a resource when a higher one starts */
+        blocking = 0;
+        response = Os_AnalyzerCooperativeResponse(index);
+#endif
+        printf("  %-4u %-12s %-8s %-10lu %-10lu %-10llu %-12llu %s\n", (unsigned)index, g_Task_By_Priority[index]->Name,
+               (g_Task_By_Priority[index]->Period == OS_TASK_NOT_PERIODIC) ? "event" : "periodic",
+               (unsigned long)g_Task_By_Priority[index]->Wcet, (unsigned long)blocking,
+               (unsigned long long)response, (unsigned long long)deadline,
+               (response > deadline) ? "MISSED" : "ok");
+        if(response > deadline)
+        {
+            feasible = FALSE;
+        }
+    }
+
+    printf("\n%s\n", (feasible == TRUE) ? "Task set is schedulable" : "Task set is NOT schedulable");
+    return (feasible == TRUE) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,354 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_OffsetPlanner.c
+ *
+ * Description: Host tool choosing the offsets of the periodic tasks which give the
+ *              smallest peak load of a tick of the hyperperiod.
+ *              It reads the periods, offsets and worst case execution times from
+ *              Os_Cfg.h, searches all the offset combinations (or places the tasks one
+ *              by one when there are too many combinations) and prints:
+ *              - The peak tick load with the configured offsets and with the chosen ones.
+ *              - The OsConf_xxx_OFFSET lines to copy in Os_Cfg.h.
+ *              - The resulting dispatch table, Os_PBcfg.c generates the same entries
+ *                once the offsets are copied.
+ *              Among the combinations with the same peak the one with the fewest peak
+ *              ticks is taken, then the configured offsets are kept where possible.
+ *                  gcc -I.. -o Os_OffsetPlanner Os_OffsetPlanner.c && ./Os_OffsetPlanner
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "Os.h"
+
+/* Largest number of offset combinations searched exhaustively */
+#define OS_PLANNER_MAX_COMBINATIONS     (1000000UL)
+
+/* Set of all the tasks */
+#define OS_PLANNER_ALL_TASKS            ((Os_TaskMaskType)(((uint64)1U << OS_CONFIGURED_TASKS) - 1U))
+
+/* Structure describes one task as seen by the planner */
+typedef struct
+{
+    const char * Name;
+    const char * Offset_Macro;
+    TaskType Task_Id;
+    /* Period in Os ticks, OS_TASK_NOT_PERIODIC for a task started by ActivateTask */
+    TickType Period;
+    TickType Offset;
+    /* Worst case execution time in microseconds */
+    uint32 Wcet;
+} Os_PlannerTaskType;
+
+/* Task set, keep it in line with the task table in Os_PBcfg.c */
+static const Os_PlannerTaskType Os_PlannerTasks[OS_CONFIGURED_TASKS] =
+{
+    { "Button_Task", "OsConf_BUTTON_TASK_OFFSET", OsConf_BUTTON_TASK_ID_INDEX, OsConf_BUTTON_TASK_PERIOD, OsConf_BUTTON_TASK_OFFSET, OsConf_BUTTON_TASK_WCET },
+    { "App_Task",    "OsConf_APP_TASK_OFFSET",    OsConf_APP_TASK_ID_INDEX,    OsConf_APP_TASK_PERIOD,    OsConf_APP_TASK_OFFSET,    OsConf_APP_TASK_WCET    },
+    { "Led_Task",    "OsConf_LED_TASK_OFFSET",    OsConf_LED_TASK_ID_INDEX,    OsConf_LED_TASK_PERIOD,    OsConf_LED_TASK_OFFSET,    OsConf_LED_TASK_WCET    }
+};
+
+/* Quality of an offset combination, a smaller one is better */
+typedef struct
+{
+    uint32 Peak_Load;
+    uint32 Peak_Ticks;
+    uint32 Moved_Tasks;
+} Os_PlannerScoreType;
+
+/*********************************************************************************************/
+/* Description: Return TRUE if a task with the given offset runs in the given tick of the hyperperiod */
+static boolean Os_PlannerRunsInTick(const Os_PlannerTaskType * Task, TickType Offset, TickType Tick)
+{
+    boolean result = TRUE;
+
+    if(Task->Period != OS_TASK_NOT_PERIODIC)
+    {
+        result = (OS_TASK_RELEASED(Tick, Task->Period, Offset) == 1UL) ? TRUE : FALSE;
+    }
+    return result;
+}
+
+/*********************************************************************************************/
+/* Description: Compute the load of every tick for the given offsets of the placed tasks */
+static void Os_PlannerLoads(const TickType * Offsets, Os_TaskMaskType Placed, uint32 * Loads)
+{
+    TickType tick;
+    uint8 index;
+
+    for(tick = 0; tick < OS_HYPERPERIOD_TICKS; tick++)
+    {
+        Loads[tick] = 0;
+        for(index = 0; index < OS_CONFIGURED_TASKS; index++)
+        {
+            if(((Placed & OS_TASK_MASK(index)) != 0U) && (Os_PlannerRunsInTick(&Os_PlannerTasks[index], Offsets[index], tick) == TRUE))
+            {
+                Loads[tick] += Os_PlannerTasks[index].Wcet;
+            }
+        }
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Score the given offsets of the placed tasks */
+static Os_PlannerScoreType Os_PlannerScore(const TickType * Offsets, Os_TaskMaskType Placed)
+{
+    Os_PlannerScoreType score = { 0U, 0U, 0U };
+    uint32 loads[OS_HYPERPERIOD_TICKS];
+    TickType tick;
+    uint8 index;
+
+    Os_PlannerLoads(Offsets, Placed, loads);
+    for(tick = 0; tick < OS_HYPERPERIOD_TICKS; tick++)
+    {
+        if(loads[tick] > score.Peak_Load)
+        {
+            score.Peak_Load  = loads[tick];
+            score.Peak_Ticks = 0;
+        }
+        if(loads[tick] == score.Peak_Load)
+        {
+            score.Peak_Ticks++;
+        }
+    }
+    for(index = 0; index < OS_CONFIGURED_TASKS; index++)
+    {
+        if(((Placed & OS_TASK_MASK(index)) != 0U) && (Offsets[index] != Os_PlannerTasks[index].Offset))
+        {
+            score.Moved_Tasks++;
+        }
+    }
+    return score;
+}
+
+/*********************************************************************************************/
+/* Description: Return TRUE if the first score is better than the second one */
+static boolean Os_PlannerBetter(const Os_PlannerScoreType * First, const Os_PlannerScoreType * Second)
+{
+    boolean result = FALSE;
+
+    if(First->Peak_Load != Second->Peak_Load)
+    {
+        result = (First->Peak_Load < Second->Peak_Load) ? TRUE : FALSE;
+    }
+    else if(First->Peak_Ticks != Second->Peak_Ticks)
+    {
+        result = (First->Peak_Ticks < Second->Peak_Ticks) ? TRUE : FALSE;
+    }
+    else
+    {
+        result = (First->Moved_Tasks < Second->Moved_Tasks) ? TRUE : FALSE;
+    }
+    return result;
+}
+
+/*********************************************************************************************/
+/* Description: Try all the offset combinations, the offsets of the best one are left in Best */
+static void Os_PlannerSearchAll(TickType * Best)
+{
+    TickType offsets[OS_CONFIGURED_TASKS];
+    Os_PlannerScoreType best_score;
+    Os_PlannerScoreType score;
+    boolean done = FALSE;
+    uint8 index;
+
+    for(index = 0; index < OS_CONFIGURED_TASKS; index++)
+    {
+        offsets[index] = 0;
+        Best[index]    = Os_PlannerTasks[index].Offset;
+    }
+    best_score = Os_PlannerScore(Best, OS_PLANNER_ALL_TASKS);
+
+    while(done == FALSE)
+    {
+        score = Os_PlannerScore(offsets, OS_PLANNER_ALL_TASKS);
+        if(Os_PlannerBetter(&score, &best_score) == TRUE)
+        {
+            best_score = score;
+            for(index = 0; index < OS_CONFIGURED_TASKS; index++)
+            {
+                Best[index] = offsets[index];
+            }
+        }
+
+        /* Next combination: count with the periods as the digits, the non periodic tasks keep the offset 0 */
+        done = TRUE;
+        for(index = 0; (index < OS_CONFIGURED_TASKS) && (done == TRUE); index++)
+        {
+            if((Os_PlannerTasks[index].Period != OS_TASK_NOT_PERIODIC) && ((offsets[index] + 1U) < Os_PlannerTasks[index].Period))
+            {
+                offsets[index]++;
+                done = FALSE;
+            }
+            else
+            {
+                offsets[index] = 0;
+            }
+        }
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Place the tasks one by one, the longest first, each at the offset giving the best partial score */
+static void Os_PlannerPlaceGreedy(TickType * Best)
+{
+    const Os_PlannerTaskType * task;
+    TickType offsets[OS_CONFIGURED_TASKS];
+    uint8 order[OS_CONFIGURED_TASKS];
+    Os_PlannerScoreType best_score;
+    Os_PlannerScoreType score;
+    Os_TaskMaskType placed = 0;
+    TickType best_offset;
+    TickType offset;
+    uint8 swap;
+    uint8 index;
+    uint8 next;
+
+    /* Sort the tasks by decreasing execution time, the shorter ones fill the gaps left by the longer ones */
+    for(index = 0; index < OS_CONFIGURED_TASKS; index++)
+    {
+        order[index] = index;
+    }
+    for(index = 0; index < OS_CONFIGURED_TASKS; index++)
+    {
+        for(next = index + 1U; next < OS_CONFIGURED_TASKS; next++)
+        {
+            if(Os_PlannerTasks[order[next]].Wcet > Os_PlannerTasks[order[index]].Wcet)
+            {
+                swap         = order[index];
+                order[index] = order[next];
+                order[next]  = swap;
+            }
+        }
+    }
+
+    /* The tasks not placed yet are left out of the scores */
+    for(index = 0; index < OS_CONFIGURED_TASKS; index++)
+    {
+        offsets[index] = Os_PlannerTasks[index].Offset;
+    }
+    for(index = 0; index < OS_CONFIGURED_TASKS; index++)
+    {
+        task        = &Os_PlannerTasks[order[index]];
+        placed     |= OS_TASK_MASK(order[index]);
+        best_offset = task->Offset;
+        offsets[order[index]] = best_offset;
+        best_score  = Os_PlannerScore(offsets, placed);
+        for(offset = 0; (task->Period != OS_TASK_NOT_PERIODIC) && (offset < task->Period); offset++)
+        {
+            offsets[order[index]] = offset;
+            score = Os_PlannerScore(offsets, placed);
+            if(Os_PlannerBetter(&score, &best_score) == TRUE)
+            {
+                best_score  = score;
+                best_offset = offset;
+            }
+        }
+        offsets[order[index]] = best_offset;
+    }
+
+    for(index = 0; index < OS_CONFIGURED_TASKS; index++)
+    {
+        Best[index] = offsets[index];
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Print the load and the tasks of every tick for the given offsets, return the peak load */
+static uint32 Os_PlannerPrintLoads(const char * Title, const TickType * Offsets)
+{
+    uint32 loads[OS_HYPERPERIOD_TICKS];
+    uint32 peak_load = 0;
+    TickType tick;
+    uint8 index;
+
+    Os_PlannerLoads(Offsets, OS_PLANNER_ALL_TASKS, loads);
+    for(tick = 0; tick < OS_HYPERPERIOD_TICKS; tick++)
+    {
+        if(loads[tick] > peak_load)
+        {
+            peak_load = loads[tick];
+        }
+    }
+
+    printf("\n%s: peak load %lu us (%.1f %% of a tick)\n", Title, (unsigned long)peak_load, (100.0 * peak_load) / OS_FRAME_TIME_US);
+    for(tick = 0; tick < OS_HYPERPERIOD_TICKS; tick++)
+    {
+        printf("  %-6lu %-8lu", (unsigned long)tick, (unsigned long)loads[tick]);
+        for(index = 0; index < OS_CONFIGURED_TASKS; index++)
+        {
+            if(Os_PlannerRunsInTick(&Os_PlannerTasks[index], Offsets[index], tick) == TRUE)
+            {
+                printf(" %s", Os_PlannerTasks[index].Name);
+            }
+        }
+        printf("%s\n", (loads[tick] == peak_load) ? "  <- peak" : "");
+    }
+    return peak_load;
+}
+
+/*********************************************************************************************/
+int main(void)
+{
+    TickType configured[OS_CONFIGURED_TASKS];
+    TickType best[OS_CONFIGURED_TASKS];
+    uint64 combinations = 1;
+    uint32 peak_before;
+    uint32 peak_after;
+    Os_TaskMaskType mask;
+    TickType tick;
+    uint8 index;
+
+    for(index = 0; index < OS_CONFIGURED_TASKS; index++)
+    {
+        configured[index] = Os_PlannerTasks[index].Offset;
+        if(Os_PlannerTasks[index].Period != OS_TASK_NOT_PERIODIC)
+        {
+            combinations *= Os_PlannerTasks[index].Period;
+        }
+    }
+
+    printf("Os task set: %u tasks, tick %lu us, hyperperiod %lu ticks, %llu offset combinations\n", (unsigned)OS_CONFIGURED_TASKS,
+           (unsigned long)OS_BASE_TIME_US, (unsigned long)OS_HYPERPERIOD_TICKS, (unsigned long long)combinations);
+    if(combinations <= OS_PLANNER_MAX_COMBINATIONS)
+    {
+        Os_PlannerSearchAll(best);
+    }
+    else
+    {
+        printf("Too many combinations, the tasks are placed one by one (the peak may not be the smallest)\n");
+        Os_PlannerPlaceGreedy(best);
+    }
+
+    peak_before = Os_PlannerPrintLoads("Configured offsets", configured);
+    peak_after  = Os_PlannerPrintLoads("Chosen offsets", best);
+    printf("\nPeak load: %lu us -> %lu us\n", (unsigned long)peak_before, (unsigned long)peak_after);
+
+    printf("\n/* Os_Cfg.h: task offsets in Os ticks, must be less than the task period */\n");
+    for(index = 0; index < OS_CONFIGURED_TASKS; index++)
+    {
+        printf("#define %-35s (%luU)\n", Os_PlannerTasks[index].Offset_Macro, (unsigned long)best[index]);
+    }
+
+    printf("\n/* Dispatch table generated by Os_PBcfg.c with these offsets, one entry per tick of the hyperperiod */\n");
+    printf("const Os_TaskMaskType Os_DispatchTable[] =\n{\n");
+    for(tick = 0; tick < OS_HYPERPERIOD_TICKS; tick++)
+    {
+        mask = 0;
+        for(index = 0; index < OS_CONFIGURED_TASKS; index++)
+        {
+            if((Os_PlannerTasks[index].Period != OS_TASK_NOT_PERIODIC) && (Os_PlannerRunsInTick(&Os_PlannerTasks[index], best[index], tick) == TRUE))
+            {
+                mask |= OS_TASK_MASK(Os_PlannerTasks[index].Task_Id);
+            }
+        }
+        printf("    0x%08lXUL%s   /* OS_DISPATCH_MASK(%luU) */\n", (unsigned long)mask, ((tick + 1U) < OS_HYPERPERIOD_TICKS) ? "," : " ",
+               (unsigned long)tick);
+    }
+    printf("};\n");
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,258 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_TraceDecoder.c
+ *
+ * Description: Host tool converting an Os binary trace to the Chrome trace JSON format,
+ *              opened by chrome://tracing or https://ui.perfetto.dev.
+ *              The input is a dump of Os_TraceBuffer:
+ *              - Target: save sizeof(Os_TraceBuffer) bytes from &Os_TraceBuffer with the
+ *                debugger (IAR: Debug > Memory > Save, binary format).
+ *              - Host simulation run: the file written by Os_HostExportTrace. In the virtual
+ *                time mode the host timestamps follow the real execution, the idle time
+ *                between the ticks is not seen.
+ *              Every task and interrupt has its own track, the Dio writes and Det reports
+ *              are instant events on the track of the running task or interrupt.
+ *                  gcc -I.. -o Os_TraceDecoder Os_TraceDecoder.c
+ *                  ./Os_TraceDecoder trace.bin > trace.json
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "Os.h"
+#include "Os_Trace.h"
+#include "Gpt.h"
+
+/* Chrome trace process and thread of the records */
+#define OS_DECODER_PID              (1U)
+#define OS_DECODER_IDLE_TID         (0U)
+#define OS_DECODER_TASK_TID(ID)     (1U + (uint32)(ID))
+#define OS_DECODER_ISR_TID(ID)      (100U + (uint32)(ID))
+
+/* Deepest nesting of the tasks and interrupts followed by the decoder */
+#define OS_DECODER_MAX_NESTING      (32U)
+
+/* Task names, keep them in line with the task table in Os_PBcfg.c */
+static const char * const Os_DecoderTaskNames[OS_CONFIGURED_TASKS] =
+{
+    "Button_Task",
+    "App_Task",
+    "Led_Task"
+};
+
+/* Track of the task or interrupt running at every nesting level, index 0 is the oldest */
+static uint32 g_Running_Tids[OS_DECODER_MAX_NESTING];
+static uint32 g_Nesting = 0;
+
+/* Separator printed before every event but the first one */
+static const char * g_Separator = "";
+
+/*********************************************************************************************/
+/* Description: Return the name of the track of a task or an interrupt */
+static const char * Os_DecoderName(uint8 Event, uint8 Id)
+{
+    static char name[24];
+    const char * result = name;
+
+    if((Event == OS_TRACE_TASK_BEGIN) && (Id < OS_CONFIGURED_TASKS))
+    {
+        result = Os_DecoderTaskNames[Id];
+    }
+    else if(Event == OS_TRACE_TASK_BEGIN)
+    {
+        snprintf(name, sizeof(name), "Task %u", (unsigned)Id);
+    }
+    else if(Id == OS_TRACE_ISR_SYSTICK)
+    {
+        result = "SysTick_Handler";
+    }
+    else if((Id >= OS_TRACE_ISR_GPT(GPT_TIMER_0)) && (Id <= OS_TRACE_ISR_GPT(GPT_TIMER_5)))
+    {
+        snprintf(name, sizeof(name), "TIMER%uA_Handler", (unsigned)(Id - OS_TRACE_ISR_GPT(GPT_TIMER_0)));
+    }
+    else if((Id >= OS_TRACE_ISR_GPT(GPT_WTIMER_0)) && (Id <= OS_TRACE_ISR_GPT(GPT_WTIMER_5)))
+    {
+        snprintf(name, sizeof(name), "WTIMER%uA_Handler", (unsigned)(Id - OS_TRACE_ISR_GPT(GPT_WTIMER_0)));
+    }
+    else
+    {
+        snprintf(name, sizeof(name), "Isr %u", (unsigned)Id);
+    }
+    return result;
+}
+
+/*********************************************************************************************/
+/* Description: Print the name of a track as a metadata event */
+static void Os_DecoderTrackName(uint32 Tid, const char * Name)
+{
+    printf("%s\n    {\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%u,\"tid\":%lu,\"args\":{\"name\":\"%s\"}}",
+           g_Separator, (unsigned)OS_DECODER_PID, (unsigned long)Tid, Name);
+    g_Separator = ",";
+}
+
+/*********************************************************************************************/
+/* Description: Open a slice on a track and make it the running track */
+static void Os_DecoderBegin(uint32 Tid, const char * Name, double Time_Us)
+{
+    printf("%s\n    {\"name\":\"%s\",\"ph\":\"B\",\"pid\":%u,\"tid\":%lu,\"ts\":%.3f}", g_Separator, Name,
+           (unsigned)OS_DECODER_PID, (unsigned long)Tid, Time_Us);
+    g_Separator = ",";
+
+    if(g_Nesting < OS_DECODER_MAX_NESTING)
+    {
+        g_Running_Tids[g_Nesting] = Tid;
+        g_Nesting++;
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Close the slice of a track, ignored for a slice which began before the oldest record */
+static void Os_DecoderEnd(uint32 Tid, double Time_Us)
+{
+    uint32 level = g_Nesting;
+
+    while((level > 0U) && (g_Running_Tids[level - 1U] != Tid))
+    {
+        level--;
+    }
+    if(level > 0U)
+    {
+        printf("%s\n    {\"ph\":\"E\",\"pid\":%u,\"tid\":%lu,\"ts\":%.3f}", g_Separator, (unsigned)OS_DECODER_PID,
+               (unsigned long)Tid, Time_Us);
+        g_Separator = ",";
+
+        /* Drop the slice from the running tracks */
+        for(; level < g_Nesting; level++)
+        {
+            g_Running_Tids[level - 1U] = g_Running_Tids[level];
+        }
+        g_Nesting--;
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Print an instant event with two arguments on the running track */
+static void Os_DecoderInstant(const char * Name, const char * Arg1, uint32 Value1, const char * Arg2, uint32 Value2,
+                              double Time_Us)
+{
+    uint32 tid = (g_Nesting > 0U) ? g_Running_Tids[g_Nesting - 1U] : OS_DECODER_IDLE_TID;
+
+    printf("%s\n    {\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"pid\":%u,\"tid\":%lu,\"ts\":%.3f,"
+           "\"args\":{\"%s\":%lu,\"%s\":%lu}}", g_Separator, Name, (unsigned)OS_DECODER_PID, (unsigned long)tid, Time_Us,
+           Arg1, (unsigned long)Value1, Arg2, (unsigned long)Value2);
+    g_Separator = ",";
+}
+
+/*********************************************************************************************/
+int main(int argc, char * argv[])
+{
+    int result = EXIT_FAILURE;
+    FILE * file = NULL;
+    Os_TraceRecordType * records = NULL;
+    Os_TraceRecordType * record;
+    uint32 header[4];
+    uint32 count = 0;
+    uint32 first;
+    uint32 index;
+    uint32 previous_timestamp = 0;
+    uint64 time = 0;
+    double time_us;
+    TaskType task_id;
+
+    if(argc == 2)
+    {
+        file = fopen(argv[1], "rb");
+    }
+    else
+    {
+        fprintf(stderr, "Usage: %s <trace dump>\n", argv[0]);
+    }
+
+    /* Header: magic, timestamp frequency, records count and index ... then the records */
+    if((file != NULL) && (fread(header, sizeof(header), 1U, file) == 1U) && (header[0] == OS_TRACE_MAGIC)
+       && (header[1] != 0U) && (header[2] != 0U) && ((header[2] & (header[2] - 1U)) == 0U))
+    {
+        records = malloc(header[2] * sizeof(Os_TraceRecordType));
+        if((records != NULL) && (fread(records, sizeof(Os_TraceRecordType), header[2], file) == header[2]))
+        {
+            result = EXIT_SUCCESS;
+        }
+    }
+    if(file != NULL)
+    {
+        fclose(file);
+    }
+
+    if(result == EXIT_SUCCESS)
+    {
+        /* The ring keeps the last Records_Count records */
+        count = (header[3] < header[2]) ? header[3] : header[2];
+        first = header[3] - count;
+
+        printf("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+        Os_DecoderTrackName(OS_DECODER_IDLE_TID, "Idle");
+        for(task_id = 0; task_id < OS_CONFIGURED_TASKS; task_id++)
+        {
+            Os_DecoderTrackName(OS_DECODER_TASK_TID(task_id), Os_DecoderTaskNames[task_id]);
+        }
+        Os_DecoderTrackName(OS_DECODER_ISR_TID(OS_TRACE_ISR_SYSTICK), Os_DecoderName(OS_TRACE_ISR_ENTER, OS_TRACE_ISR_SYSTICK));
+
+        for(index = 0; index < count; index++)
+        {
+            record = &records[(first + index) & (header[2] - 1U)];
+
+            /* The timestamp counter wraps around, the time of the first record is 0 */
+            if(index != 0U)
+            {
+                time += (uint32)(record->Timestamp - previous_timestamp);
+            }
+            previous_timestamp = record->Timestamp;
+            time_us = ((double)time * 1000000.0) / (double)header[1];
+
+            switch(record->Event)
+            {
+                case OS_TRACE_TASK_BEGIN:
+                    Os_DecoderBegin(OS_DECODER_TASK_TID(record->Id), Os_DecoderName(record->Event, record->Id), time_us);
+                    break;
+                case OS_TRACE_TASK_END:
+                    Os_DecoderEnd(OS_DECODER_TASK_TID(record->Id), time_us);
+                    break;
+                case OS_TRACE_ISR_ENTER:
+                    Os_DecoderBegin(OS_DECODER_ISR_TID(record->Id), Os_DecoderName(record->Event, record->Id), time_us);
+                    break;
+                case OS_TRACE_ISR_EXIT:
+                    Os_DecoderEnd(OS_DECODER_ISR_TID(record->Id), time_us);
+                    break;
+                case OS_TRACE_DIO_WRITE:
+                    Os_DecoderInstant("Dio_WriteChannel", "channel", record->Id, "level", record->Data, time_us);
+                    break;
+                case OS_TRACE_DIO_FLIP:
+                    Os_DecoderInstant("Dio_FlipChannel", "channel", record->Id, "level", record->Data, time_us);
+                    break;
+                case OS_TRACE_DET_REPORT:
+                    printf("%s\n    {\"name\":\"Det_ReportError\",\"ph\":\"i\",\"s\":\"g\",\"pid\":%u,\"tid\":%u,\"ts\":%.3f,"
+                           "\"args\":{\"module\":%u,\"service\":%u,\"error\":%u}}", g_Separator, (unsigned)OS_DECODER_PID,
+                           (unsigned)OS_DECODER_IDLE_TID, time_us, (unsigned)record->Id, (unsigned)(record->Data >> 8),
+                           (unsigned)(record->Data & 0xFFU));
+                    g_Separator = ",";
+                    break;
+                default:
+                    fprintf(stderr, "Unknown event %u in record %lu\n", (unsigned)record->Event, (unsigned long)(first + index));
+                    break;
+            }
+        }
+        printf("\n]}\n");
+
+        fprintf(stderr, "%lu records decoded, %lu overwritten\n", (unsigned long)count, (unsigned long)first);
+    }
+    else if(argc == 2)
+    {
+        fprintf(stderr, "%s is not an Os trace dump\n", argv[1]);
+    }
+
+    free(records);
+    return result;
+}
@@ -1,7 +1,17 @@
 #include "Os.h"
+#include "Mcu.h"
 
 int main(void)
 {
+    /* Latch the reset reason and apply the core clock setting */
+    Mcu_Init(&Mcu_Configuration);
+    (void)Mcu_InitClock(McuConf_CORE_CLOCK_SETTING);
+#if (McuConf_CORE_CLOCK_USES_PLL == TRUE)
+    /* The core clock runs from the oscillator until the PLL is locked, a setting without the PLL powers it down */
+    while(MCU_PLL_LOCKED != Mcu_GetPllStatus());
+    (void)Mcu_DistributePllClock();
+#endif
+
     /* Start the Os */
     Os_start();
 }